@@ -5,6 +5,7 @@
  */
 
 #include "I2C_device.h"
+#include <algorithm>
 
 Serial_device::Serial_device() {}
 Serial_device::~Serial_device() {}
@@ -13,6 +14,109 @@ void 		Serial_device::write_r16( uint8_t reg, uint16_t val ) {}
 uint16_t	Serial_device::read_r16( uint8_t reg ) { return 0; }
 void		Serial_device::bit_op16( uint8_t reg, uint16_t mask, uint16_t value ) {}
 
+void Serial_device::shadow_enable( bool enable )
+{
+	if ( enable )
+	{
+		shadow.reset( new shadow_regs( (shadow_mask + 1) * shadow_width ) );
+	}
+	else
+	{
+		shadow.reset();
+	}
+}
+
+void Serial_device::shadow_config( uint8_t reg_mask, uint8_t reg_width )
+{
+	shadow_mask		= reg_mask;
+	shadow_width	= reg_width ? reg_width : 1;
+}
+
+void Serial_device::shadow_volatile( uint8_t reg, uint16_t count )
+{
+	if ( !shadow )
+		return;
+
+	for ( int i = 0; i < count * shadow_width; i++ )
+	{
+		int	n	= shadow_index( reg, i );
+
+		if ( n < 0 )
+			break;
+
+		shadow->volatile_reg[ n / 32 ]	|=  (1UL << (n % 32));
+		shadow->valid[ n / 32 ]			&= ~(1UL << (n % 32));
+	}
+}
+
+void Serial_device::shadow_invalidate( void )
+{
+	if ( shadow )
+		std::fill( shadow->valid.begin(), shadow->valid.end(), 0 );
+}
+
+void Serial_device::shadow_invalidate( uint8_t reg, uint16_t size )
+{
+	if ( !shadow )
+		return;
+
+	for ( int i = 0; i < size; i++ )
+	{
+		int	n	= shadow_index( reg, i );
+
+		if ( n < 0 )
+			break;
+
+		shadow->valid[ n / 32 ]	&= ~(1UL << (n % 32));
+	}
+}
+
+bool Serial_device::shadow_load( uint8_t reg, uint8_t *data, uint16_t size )
+{
+	if ( !shadow )
+		return false;
+
+	for ( int i = 0; i < size; i++ )
+	{
+		int	n	= shadow_index( reg, i );
+
+		if ( (n < 0) || !(shadow->valid[ n / 32 ] & (1UL << (n % 32))) )
+			return false;
+	}
+
+	for ( int i = 0; i < size; i++ )
+		data[ i ]	= shadow->value[ shadow_index( reg, i ) ];
+
+	return true;
+}
+
+void Serial_device::shadow_store( uint8_t reg, const uint8_t *data, uint16_t size )
+{
+	if ( !shadow )
+		return;
+
+	for ( int i = 0; i < size; i++ )
+	{
+		int	n	= shadow_index( reg, i );
+
+		if ( n < 0 )
+			break;
+
+		if ( shadow->volatile_reg[ n / 32 ] & (1UL << (n % 32)) )
+			continue;
+
+		shadow->value[ n ]		 = data[ i ];
+		shadow->valid[ n / 32 ]	|= 1UL << (n % 32);
+	}
+}
+
+int Serial_device::shadow_index( uint8_t reg, uint16_t offset )
+{
+	int	n	= (reg & shadow_mask) * shadow_width + offset;
+
+	return (n < (int)shadow->value.size()) ? n : -1;
+}
+
 I2C_device::I2C_device( I2C& interface, uint8_t i2c_address, bool repeated_start_enable ) : i2c( interface ), i2c_addr( i2c_address ), rs_dis( !repeated_start_enable )
 {
 }
@@ -49,7 +153,12 @@ int I2C_device::reg_w( uint8_t reg_adr, const uint8_t *data, uint16_t size )
 	for ( uint16_t i = 0; i < size; i++)
 		buffer[ i + 1 ]	= data[ i ];
 	
-	return tx( buffer, sizeof( buffer ) );
+	int	r	= tx( buffer, sizeof( buffer ) );
+
+	if ( kStatus_Success == r )
+		shadow_store( reg_adr, data, size );
+
+	return r;
 }
 
 int I2C_device::reg_w( uint8_t reg_adr, uint8_t data )
@@ -59,24 +168,70 @@ int I2C_device::reg_w( uint8_t reg_adr, uint8_t data )
 	buffer[ 0 ]	= reg_adr;
 	buffer[ 1 ]	= data;
 	
-	return tx( buffer, sizeof( buffer ) );
+	int	r	= tx( buffer, sizeof( buffer ) );
+
+	if ( kStatus_Success == r )
+		shadow_store( reg_adr, &data, 1 );
+
+	return r;
 }
 
 int I2C_device::reg_r( uint8_t reg_adr, uint8_t *data, uint16_t size )
 {
-	tx( &reg_adr, 1, rs_dis );
-	return rx( data, size );
+	if ( shadow_load( reg_adr, data, size ) )
+		return kStatus_Success;
+
+	int	r;
+
+	//	reg_read() lets the bus frame it as one transfer (I3C HDR-DDR command)
+	if ( rs_dis )
+	{
+		tx( &reg_adr, 1, rs_dis );
+		r	= rx( data, size );
+	}
+	else
+	{
+		r	= i2c.reg_read( i2c_addr, reg_adr, data, size );
+	}
+
+	if ( kStatus_Success == r )
+		shadow_store( reg_adr, data, size );
+
+	return r;
 }
 
 uint8_t I2C_device::reg_r( uint8_t reg_adr )
 {
 	uint8_t	buffer	= 0;	//	assignning zero to suppress warning "-Wmaybe-uninitialized"
 	
+	if ( shadow_load( reg_adr, &buffer, 1 ) )
+		return buffer;
+
 	tx( &reg_adr, 1, rs_dis );
-	rx( &buffer, 1 );
+
+	if ( kStatus_Success == rx( &buffer, 1 ) )
+		shadow_store( reg_adr, &buffer, 1 );
+
 	return buffer;
 } 
 
+int I2C_device::reg_w( I2C::Batch& batch, uint8_t reg_adr, const uint8_t *data, uint16_t size )
+{
+	shadow_invalidate( reg_adr, size );
+	return batch.reg_write( i2c_addr, reg_adr, data, size );
+}
+
+int I2C_device::reg_w( I2C::Batch& batch, uint8_t reg_adr, uint8_t data )
+{
+	shadow_invalidate( reg_adr, 1 );
+	return batch.reg_write( i2c_addr, reg_adr, data );
+}
+
+int I2C_device::reg_r( I2C::Batch& batch, uint8_t reg_adr, uint8_t *data, uint16_t size )
+{
+	return batch.reg_read( i2c_addr, reg_adr, data, size );
+}
+
 void I2C_device::write_r8( uint8_t reg, uint8_t val )
 {
 	reg_w( reg, val );
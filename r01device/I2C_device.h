@@ -8,6 +8,8 @@
 #define ARDUINO_I2C_DEVICE_H
 
 #include <stdint.h>
+#include <memory>
+#include <vector>
 #include "r01lib.h"
 
 /** Serial_device class
@@ -15,6 +17,12 @@
  *  @class Serial_device
  *
  *	An abstraction class for all serial interface devices
+ *
+ *	Register shadow (option):
+ *	Values written to and read from registers are kept in RAM and register reads are served from it. 
+ *	It eliminates bus reads for read-modify-write operations like bit_op8(). 
+ *	Registers which change in the device (status, data, etc.) need to be marked as volatile. 
+ *	Device classes mark their volatile registers in shadow_enable(). 
  */
 
 class Serial_device
@@ -35,6 +43,75 @@ public:
 	virtual void write_r16( uint8_t reg, uint16_t val );
 	virtual uint16_t read_r16( uint8_t reg );
 	virtual void bit_op16( uint8_t reg, uint16_t mask, uint16_t value );
+
+	/** Register shadow enable
+	 *
+	 *	Shadow is cleared by enabling. All registers are non-volatile after enabling
+	 *
+	 * @param enable true to enable, false to disable and release memory
+	 */
+	virtual void shadow_enable( bool enable = true );
+
+	/** Register shadow configuration, should be set before enabling
+	 *
+	 *	Shadow has (reg_mask + 1) * reg_width bytes. Accesses beyond it are not served from the shadow
+	 *
+	 * @param reg_mask mask for register address. To ignore auto-increment flag bit in register address
+	 * @param reg_width bytes in a register. 2 for devices which have 16 bit registers and no address increment (like LM75B)
+	 */
+	void shadow_config( uint8_t reg_mask, uint8_t reg_width = 1 );
+
+	/** Mark registers as volatile. Volatile registers are always read from device
+	 *
+	 * @param reg register index/address/pointer
+	 * @param count (option) number of registers
+	 */
+	void shadow_volatile( uint8_t reg, uint16_t count = 1 );
+
+	/** Clear shadow. Next reads are performed on the bus
+	 */
+	void shadow_invalidate( void );
+
+	/** Clear shadow of registers
+	 *
+	 * @param reg register index/address/pointer
+	 * @param size data size in bytes
+	 */
+	void shadow_invalidate( uint8_t reg, uint16_t size );
+
+protected:
+	/** Read from shadow
+	 *
+	 * @param reg register index/address/pointer
+	 * @param data pointer to data buffer
+	 * @param size data size
+	 * @return true if all data is available in shadow
+	 */
+	bool shadow_load( uint8_t reg, uint8_t *data, uint16_t size );
+
+	/** Update shadow by written or read data. Volatile registers are not stored
+	 *
+	 * @param reg register index/address/pointer
+	 * @param data pointer to data buffer
+	 * @param size data size
+	 */
+	void shadow_store( uint8_t reg, const uint8_t *data, uint16_t size );
+
+private:
+	struct shadow_regs {
+		shadow_regs( int size ) : value( size ), valid( (size + 31) / 32 ), volatile_reg( (size + 31) / 32 ) {}
+
+		std::vector<uint8_t>	value;
+		std::vector<uint32_t>	valid;
+		std::vector<uint32_t>	volatile_reg;
+	};
+
+	/** Index in the shadow, -1 if out of the shadow */
+	int			shadow_index( uint8_t reg, uint16_t offset );
+
+	std::unique_ptr<shadow_regs>	shadow;
+	uint8_t							shadow_mask		= 0xFF;
+	uint8_t							shadow_width	= 1;
 };
 
 /** I2C_device class
@@ -158,6 +235,39 @@ public:
 	void bit_op8(  uint8_t reg,  uint8_t mask,  uint8_t value );
 	void bit_op16( uint8_t reg, uint16_t mask, uint16_t value );
 
+	/** Multiple register write, recorded into a batch
+	 *
+	 *	The transaction is performed when I2C::Batch::execute() is called
+	 *
+	 * @param batch I2C::Batch instance to record the transaction
+	 * @param reg register index/address/pointer
+	 * @param data pointer to data buffer
+	 * @param size data size
+	 * @return index of recorded entry in the batch
+	 */
+	int reg_w( I2C::Batch& batch, uint8_t reg_adr, const uint8_t *data, uint16_t size );
+
+	/** Single register write, recorded into a batch
+	 *
+	 * @param batch I2C::Batch instance to record the transaction
+	 * @param reg  register index/address/pointer
+	 * @param data data to write
+	 * @return index of recorded entry in the batch
+	 */
+	int reg_w( I2C::Batch& batch, uint8_t reg_adr, uint8_t data );
+
+	/** Multiple register read, recorded into a batch
+	 *
+	 *	Read data is available in the buffer after I2C::Batch::execute() is called
+	 *
+	 * @param batch I2C::Batch instance to record the transaction
+	 * @param reg register index/address/pointer
+	 * @param data pointer to data buffer
+	 * @param size data size
+	 * @return index of recorded entry in the batch
+	 */
+	int reg_r( I2C::Batch& batch, uint8_t reg_adr, uint8_t *data, uint16_t size );
+
 	/** ping
 	 *		check device returns ACK
 	 *
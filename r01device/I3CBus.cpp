@@ -0,0 +1,275 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license License
+ */
+
+#include	<math.h>
+
+#include	"I3CBus.h"
+
+#ifdef I3C_SUPPORTED
+
+I3CBus::I3CBus( I3C& interface ) : i3c( interface ), n_devices( 0 ), n_bindings( 0 )
+{
+	bind<P3T1755>( P3T1755_PART_ID );
+	bind<P3T1085>( P3T1085_PART_ID );
+	bind<P3T1035>( P3T1035_PART_ID );
+	bind<P3T2030>( P3T2030_PART_ID );
+}
+
+I3CBus::~I3CBus()
+{
+	hot_join_enable( false );
+}
+
+bool I3CBus::bind( uint16_t part_id, factory_t factory, uint16_t manufacturer, bool temp_sensor )
+{
+	for ( int i = 0; i < n_bindings; i++ )
+	{
+		if ( (bindings[ i ].manufacturer == manufacturer) && (bindings[ i ].part_id == part_id) )
+		{
+			bindings[ i ].factory		= factory;
+			bindings[ i ].temp_sensor	= temp_sensor;
+			return true;
+		}
+	}
+
+	if ( MAX_BINDINGS <= n_bindings )
+		return false;
+
+	bindings[ n_bindings++ ]	= { manufacturer, part_id, factory, temp_sensor };
+
+	return true;
+}
+
+int I3CBus::sample_all( float *celsius )
+{
+	I2C::Batch				trigger( i3c );
+	I2C::Batch				batch( i3c );
+	I2C::Batch				restore( i3c );
+	TempSensor::one_shot_t	os[ MAX_DEVICES ];
+	uint8_t					raw[ MAX_DEVICES ][ 2 ];
+	int						index[ MAX_DEVICES ];
+	int						n			= 0;
+	int						wait_time	= 0;
+
+	for ( int i = 0; i < n_devices; i++ )
+	{
+		celsius[ i ]	= NAN;
+
+		if ( devices[ i ].temp_sensor && devices[ i ].driver )
+			index[ n++ ]	= i;
+	}
+
+	if ( !n )
+		return 0;
+
+	//	Conf is read by each driver before triggering, so that the triggers can go back to back
+	for ( int i = 0; i < n; i++ )
+	{
+		if ( !driver<TempSensor>( index[ i ] )->one_shot( os[ i ] ) )
+			continue;
+
+		trigger.reg_write( devices[ index[ i ] ].address, os[ i ].reg, os[ i ].trigger, os[ i ].length );
+		restore.reg_write( devices[ index[ i ] ].address, os[ i ].reg, os[ i ].restore, os[ i ].length );
+
+		if ( wait_time < os[ i ].conversion_us )
+			wait_time	= os[ i ].conversion_us;
+	}
+
+	if ( wait_time )
+	{
+		trigger.execute();
+		wait_us( wait_time );
+	}
+
+	for ( int i = 0; i < n; i++ )
+		batch.reg_read( devices[ index[ i ] ].address, P3T1755::Temp, raw[ i ], sizeof( raw[ i ] ) );
+
+	batch.execute();
+
+	if ( wait_time )
+		restore.execute();
+
+	int	count	= 0;
+
+	for ( int i = 0; i < n; i++ )
+	{
+		if ( kStatus_Success != batch.status( i ) )
+			continue;
+
+		//	LM75B compatible format: left justified 2's complement, 1/256 degree
+		celsius[ index[ i ] ]	= (int16_t)((raw[ i ][ 0 ] << 8) | raw[ i ][ 1 ]) / 256.0;
+		count++;
+	}
+
+	return count;
+}
+
+int I3CBus::enumerate( const uint8_t *static_addresses, int length )
+{
+	for ( int i = 0; i < n_devices; i++ )
+		devices[ i ].driver.reset();
+
+	n_devices	= 0;
+
+	i3c.ccc_broadcast( BROADCAST_RSTDAA, nullptr, 0 );
+
+	uint8_t	address	= FIRST_ADDRESS;
+
+	for ( int i = 0; i < length; i++ )
+	{
+		if ( !(address = next_address( address )) || (MAX_DEVICES <= n_devices) )
+			break;
+
+		if ( kStatus_Success != i3c.ccc_set( DIRECT_SETDASA, static_addresses[ i ], address << 1 ) )
+			continue;
+
+		uint8_t		pid[ I3C::PID_LENGTH ]	= { 0 };
+		uint8_t		bcr	= 0;
+		uint8_t		dcr	= 0;
+		uint64_t	v	= 0;
+
+		i3c.ccc_get( DIRECT_GETPID, address, pid, sizeof( pid ) );
+		i3c.ccc_get( DIRECT_GETBCR, address, &bcr, 1 );
+		i3c.ccc_get( DIRECT_GETDCR, address, &dcr, 1 );
+
+		for ( int j = 0; j < I3C::PID_LENGTH; j++ )
+			v	= (v << 8) | pid[ j ];
+
+		add( address, static_addresses[ i ], v, bcr, dcr );
+	}
+
+	daa();
+
+	return n_devices;
+}
+
+int I3CBus::hot_join( void )
+{
+	return daa();
+}
+
+void I3CBus::hot_join_enable( bool enable )
+{
+	uint8_t	events	= ENEC_INT | ENEC_HJ;
+
+	if ( enable )
+	{
+		i3c.ibi_handler( I3C::HOT_JOIN_ADDR, hot_join_handler, this );
+		i3c.ccc_broadcast( BROADCAST_ENEC, &events, 1 );
+	}
+	else
+	{
+		events	= ENEC_HJ;
+		i3c.ccc_broadcast( BROADCAST_DISEC, &events, 1 );
+		i3c.ibi_handler( I3C::HOT_JOIN_ADDR, nullptr );
+	}
+}
+
+int I3CBus::count( void )
+{
+	return n_devices;
+}
+
+I3CBus::device& I3CBus::operator[]( int index )
+{
+	return devices[ index ];
+}
+
+I3CBus::device* I3CBus::find( uint8_t address )
+{
+	for ( int i = 0; i < n_devices; i++ )
+		if ( devices[ i ].address == address )
+			return &devices[ i ];
+
+	return nullptr;
+}
+
+void I3CBus::hot_join_handler( const I3C::ibi_event& event, void *context )
+{
+	((I3CBus *)context)->hot_join();
+}
+
+int I3CBus::daa( void )
+{
+	uint8_t	list[ MAX_DEVICES ];
+	int		n		= 0;
+	uint8_t	address	= FIRST_ADDRESS;
+
+	//	free addresses only, targets in the table are not affected
+	while ( (n < MAX_DEVICES - n_devices) && (address = next_address( address )) )
+		list[ n++ ]	= address++;
+
+	if ( !n )
+		return 0;
+
+	i3c_device_info_t	*info;
+	int					found	= i3c.DAA( list, n, &info );
+	int					added	= 0;
+
+	for ( int i = 0; i < found; i++ )
+	{
+		if ( find( info[ i ].dynamicAddr ) )
+			continue;
+
+		uint64_t	pid	= ((uint64_t)info[ i ].vendorID << 33) | info[ i ].partNumber;
+
+		if ( add( info[ i ].dynamicAddr, 0, pid, info[ i ].bcr, info[ i ].dcr ) )
+			added++;
+	}
+
+	return added;
+}
+
+bool I3CBus::add( uint8_t address, uint8_t static_address, uint64_t pid, uint8_t bcr, uint8_t dcr )
+{
+	if ( MAX_DEVICES <= n_devices )
+		return false;
+
+	device&	d	= devices[ n_devices++ ];
+
+	d.pid				= pid;
+	d.address			= address;
+	d.static_address	= static_address;
+	d.bcr				= bcr;
+	d.dcr				= dcr;
+	d.temp_sensor		= false;
+	d.factory			= nullptr;
+
+	d.driver.reset();
+
+	for ( int i = 0; i < n_bindings; i++ )
+	{
+		if ( (bindings[ i ].manufacturer == manufacturer( pid )) && (bindings[ i ].part_id == part_id( pid )) )
+		{
+			d.driver.reset( bindings[ i ].factory( i3c, address ) );
+			d.temp_sensor	= bindings[ i ].temp_sensor;
+			d.factory		= bindings[ i ].factory;
+			break;
+		}
+	}
+
+	return true;
+}
+
+uint8_t I3CBus::next_address( uint8_t from )
+{
+	for ( uint8_t address = from; address < 0x7F; address++ )
+		if ( !reserved( address ) && !find( address ) )
+			return address;
+
+	return 0;
+}
+
+bool I3CBus::reserved( uint8_t address )
+{
+	//	broadcast address and addresses with single bit difference from it
+	uint8_t	diff	= address ^ I3C::BROADCAST_ADDR;
+
+	return (address < FIRST_ADDRESS) || !(diff & (diff - 1));
+}
+
+#else	//	I3C_SUPPORTED
+#endif	//	I3C_SUPPORTED
@@ -0,0 +1,248 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+#ifndef R01LIB_I3C_BUS_H
+#define R01LIB_I3C_BUS_H
+
+#include	<stdint.h>
+#include	<memory>
+#include	<type_traits>
+#include	"r01lib.h"
+#include	"I2C_device.h"
+#include	"temp_sensor/TempSensor.h"
+
+#ifdef I3C_SUPPORTED
+
+/** I3CBus class
+ *
+ *  @class I3CBus
+ *
+ *	I3C bus manager.
+ *	Assigns dynamic addresses by SETDASA and ENTDAA, keeps PID/BCR/DCR of each target in a table
+ *	and creates device driver instance for known parts (keyed on manufacturer ID and part ID in PID).
+ *	Targets joined by Hot-Join are added to the table without disturbing others.
+ *
+ *	Example:
+ *	@code
+ *	I3C		i3c( I3C_SDA, I3C_SCL );
+ *	I3CBus	bus( i3c );
+ *
+ *	bus.bind<MySensor>( 0x1234 );	//	add part which is not in default table (part ID: PID[31:16])
+ *	bus.enumerate();
+ *	bus.hot_join_enable();
+ *
+ *	for ( int i = 0; i < bus.count(); i++ )
+ *	{
+ *		if ( TempSensor *s = bus.driver<TempSensor>( i ) )	//	nullptr unless the driver is a TempSensor
+ *			printf( "0x%02X: %f\r\n", bus[ i ].address, s->temp() );
+ *		else if ( MySensor *m = bus.driver<MySensor>( i ) )	//	nullptr unless the driver was bound as MySensor
+ *			m->read();
+ *	}
+ *
+ *	float	t[ I3CBus::MAX_DEVICES ];
+ *	bus.sample_all( t );	//	all temperature sensors triggered and read in one sequence
+ *
+ *	while ( true )
+ *		i3c.ibi_dispatch();	//	Hot-Join is handled in this
+ *	@endcode
+ */
+
+class I3CBus
+{
+public:
+	/** constants */
+	enum MISC
+	{
+		MAX_DEVICES				= 16,
+		MAX_BINDINGS			= 8,
+		FIRST_ADDRESS			= 0x08,
+		NXP_MANUFACTURER_ID		= 0x11B,
+		ENEC_INT				= 0x01,
+		ENEC_HJ					= 0x08,
+	};
+
+	/** Part IDs (PID[31:16]) of NXP temperature sensors */
+	enum PART_ID
+	{
+		P3T1755_PART_ID			= 0x152A,
+		P3T1085_PART_ID			= 0x1085,
+		P3T1035_PART_ID			= 0x1035,
+		P3T2030_PART_ID			= 0x2030,
+	};
+
+	/** Function to create a driver instance */
+	using factory_t	= I2C_device* (*)( I2C& interface, uint8_t address );
+
+	/** Target information */
+	struct device
+	{
+		uint64_t					pid;			/**< 48 bit Provisioned ID */
+		uint8_t						address;		/**< dynamic address */
+		uint8_t						static_address;	/**< static address if assigned by SETDASA, 0 for ENTDAA */
+		uint8_t						bcr;			/**< Bus Characteristics Register */
+		uint8_t						dcr;			/**< Device Characteristics Register */
+		bool						temp_sensor;	/**< driver is a TempSensor */
+		factory_t					factory;		/**< factory which created the driver. identifies the driver class */
+		std::unique_ptr<I2C_device>	driver;			/**< driver instance, nullptr for unknown part */
+	};
+
+	/** Create an I3CBus instance
+	 *
+	 *	P3T1755, P3T1085, P3T1035 and P3T2030 are bound by default
+	 *
+	 * @param interface I3C instance
+	 */
+	I3CBus( I3C& interface );
+	virtual ~I3CBus();
+
+	/** Bind a driver to a part
+	 *
+	 * @param part_id part ID (PID[31:16])
+	 * @param factory function to create driver. use I3CBus::create<T>
+	 * @param manufacturer (option) MIPI manufacturer ID (PID[47:33])
+	 * @param temp_sensor (option) true if the driver is a TempSensor
+	 * @return true if bound, false if binding table is full
+	 */
+	bool		bind( uint16_t part_id, factory_t factory, uint16_t manufacturer = NXP_MANUFACTURER_ID, bool temp_sensor = false );
+
+	/** Bind a driver class to a part
+	 *
+	 * @tparam T driver class which has constructor of ( I2C&, uint8_t )
+	 * @param part_id part ID (PID[31:16])
+	 * @param manufacturer (option) MIPI manufacturer ID (PID[47:33])
+	 * @return true if bound, false if binding table is full
+	 */
+	template<class T>
+	bool		bind( uint16_t part_id, uint16_t manufacturer = NXP_MANUFACTURER_ID )
+	{
+		return bind( part_id, create<T>, manufacturer, std::is_base_of_v<TempSensor, T> );
+	}
+
+	/** Sample all temperature sensors
+	 *
+	 *	Sensors which have one-shot (TempSensor::one_shot()) are triggered back to back in one framed sequence, 
+	 *	then Temp registers of all targets bound to TempSensor drivers are read in one sequence after 
+	 *	the longest conversion time. Conf registers are restored after the read. 
+	 *	Sensors without one-shot are not triggered. Their Temp register holds its last completed conversion, 
+	 *	so the value can be up to one conversion period old
+	 *
+	 * @param celsius array of MAX_DEVICES (or count()) for results, indexed same as the table. NAN for other targets
+	 * @return number of sensors sampled successfully
+	 */
+	int			sample_all( float *celsius );
+
+	/** Enumerate the bus
+	 *
+	 *	All dynamic addresses are reset by RSTDAA.
+	 *	Targets with static address are assigned by SETDASA first, then others are assigned by ENTDAA.
+	 *	Drivers created by previous enumeration are deleted
+	 *
+	 * @param static_addresses (option) static addresses of targets to be assigned by SETDASA
+	 * @param length (option) number of static addresses
+	 * @return number of targets found
+	 */
+	int			enumerate( const uint8_t *static_addresses = nullptr, int length = 0 );
+
+	/** Assign address to newly joined targets by ENTDAA
+	 *
+	 *	Targets in the table keep their addresses and drivers
+	 *
+	 * @return number of targets added
+	 */
+	int			hot_join( void );
+
+	/** Enable Hot-Join
+	 *
+	 *	Hot-Join is enabled by ENEC and handled by I3C::ibi_dispatch()
+	 *
+	 * @param enable (option) false to disable
+	 */
+	void		hot_join_enable( bool enable = true );
+
+	/** Number of targets
+	 *
+	 * @return number of targets in the table
+	 */
+	int			count( void );
+
+	/** Target information
+	 *
+	 * @param index index in the table
+	 * @return target information
+	 */
+	device&		operator[]( int index );
+
+	/** Find target by dynamic address
+	 *
+	 * @param address dynamic address
+	 * @return pointer to target information, nullptr if not found
+	 */
+	device*		find( uint8_t address );
+
+	/** Driver instance
+	 *
+	 *	The driver class is checked without RTTI. T needs to be I2C_device, TempSensor (for drivers bound as TempSensor) 
+	 *	or the class given to bind<T>(). Other base classes give nullptr
+	 *
+	 * @tparam T driver class
+	 * @param index index in the table
+	 * @return pointer to the driver, nullptr for unknown part or if the driver is not a T
+	 */
+	template<class T>
+	T*			driver( int index )
+	{
+		device&	d	= devices[ index ];
+
+		if constexpr ( std::is_same_v<T, I2C_device> )
+			return d.driver.get();
+		else if constexpr ( std::is_same_v<T, TempSensor> )
+			return d.temp_sensor ? static_cast<TempSensor *>( d.driver.get() ) : nullptr;
+		else
+			return (d.factory == create<T>) ? static_cast<T *>( d.driver.get() ) : nullptr;
+	}
+
+	/** Factory for bind()
+	 *
+	 * @tparam T driver class which has constructor of ( I2C&, uint8_t )
+	 */
+	template<class T>
+	static I2C_device*	create( I2C& interface, uint8_t address )
+	{
+		return new T( interface, address );
+	}
+
+	/** MIPI manufacturer ID in PID */
+	static uint16_t	manufacturer( uint64_t pid ) { return (pid >> 33) & 0x7FFF; }
+
+	/** Part ID in PID */
+	static uint16_t	part_id( uint64_t pid ) { return (pid >> 16) & 0xFFFF; }
+
+private:
+	static void	hot_join_handler( const I3C::ibi_event& event, void *context );
+
+	int			daa( void );
+	bool		add( uint8_t address, uint8_t static_address, uint64_t pid, uint8_t bcr, uint8_t dcr );
+	uint8_t		next_address( uint8_t from );
+	bool		reserved( uint8_t address );
+
+	I3C&		i3c;
+	device		devices[ MAX_DEVICES ];
+	int			n_devices;
+
+	struct binding
+	{
+		uint16_t	manufacturer;
+		uint16_t	part_id;
+		factory_t	factory;
+		bool		temp_sensor;
+	}			bindings[ MAX_BINDINGS ];
+	int			n_bindings;
+};
+
+#else	//	I3C_SUPPORTED
+#endif	//	I3C_SUPPORTED
+
+#endif	//	R01LIB_I3C_BUS_H
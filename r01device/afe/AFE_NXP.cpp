@@ -75,7 +75,7 @@ void NAFE13388_Base::LogicalChannel::configure( uint16_t cc0, uint16_t cc1, uint
 /* AFE_base class ******************************************/
 
 AFE_base::AFE_base( SPI& spi, bool spi_addr, bool hsv, int nINT, int DRDY, int SYN, int nRESET, int SYNCDAC ) :
-	SPI_for_AFE( spi, spi_addr ), highspeed_variant( hsv ), pin_nINT( nINT ), pin_DRDY( DRDY ), pin_SYN( SYN ), pin_nRESET( nRESET, 1 ), pin_SYNCDAC( SYNCDAC ), enabled_channels( 0 )
+	SPI_for_AFE( spi, spi_addr ), highspeed_variant( hsv ), pin_nINT( nINT ), pin_DRDY( DRDY ), pin_SYN( SYN ), pin_nRESET( nRESET, 1 ), pin_SYNCDAC( SYNCDAC ), enabled_channels( 0 ), stream_head( 0 ), stream_tail( 0 ), stream_sequence( 0 ), stream_overrun( 0 ), drdy_waiter( nullptr )
 {
 }
 
@@ -99,7 +99,10 @@ void AFE_base::begin( void )
 
 void AFE_base::set_DRDY_callback( callback_fp_t func )
 {
-	cbf_DRDY	= func;
+	//	swap with IRQ masked so DRDY_cb() never sees a half assigned callback. old one is destroyed out of the mask
+	uint32_t	primask	= DisableGlobalIRQ();
+	cbf_DRDY.swap( func );
+	EnableGlobalIRQ( primask );
 }
 
 void AFE_base::DRDY_cb( void )
@@ -111,6 +114,23 @@ void AFE_base::DRDY_cb( void )
 void AFE_base::default_drdy_cb( void )
 {
 	drdy_count++;
+
+	//	DRDY and timeout race. the first one takes the waiter
+	uint32_t		primask	= DisableGlobalIRQ();
+	drdy_awaiter	*w		= drdy_waiter;
+
+	drdy_waiter	= nullptr;
+	EnableGlobalIRQ( primask );
+
+	if ( w )
+	{
+#ifndef	CPU_MCXC444VLH
+		w->timeout.detach();
+#endif
+		Scheduler::resume_later( w->node );
+		return;
+	}
+
 	drdy_flag		= true;
 }
 
@@ -124,6 +144,16 @@ int32_t AFE_base::start_and_read( int ch )
 	return read( ch );
 };
 
+Task<AFE_base::raw_t> AFE_base::start_and_read_async( int ch )
+{
+	double	wait_time	= cbf_DRDY ? -1.0 : ch_delay[ ch ] * delay_accuracy;
+
+	start( ch );
+	co_await wait_conversion_complete_async( wait_time );
+
+	co_return read( ch );
+}
+
 #ifdef	NON_TEMPLATE_VERSION_FOR_START_AND_READ
 void AFE_base::start_and_read( raw_t* data )
 {
@@ -185,6 +215,76 @@ int AFE_base::wait_conversion_complete( double delay )
 	return	0;
 }
 
+Task<int> AFE_base::wait_conversion_complete_async( double delay )
+{
+	if ( 0 < delay )
+	{
+		co_await Scheduler::sleep( delay * delay_accuracy );
+		co_return 0;
+	}
+
+	co_return co_await drdy_awaiter( this );
+}
+
+bool AFE_base::drdy_awaiter::await_ready( void )
+{
+	if ( !afe->drdy_flag )
+		return false;
+
+	afe->drdy_flag	= false;
+	return true;
+}
+
+bool AFE_base::drdy_awaiter::await_suspend( std::coroutine_handle<> handle )
+{
+	node.handle	= handle;
+
+	uint32_t	primask	= DisableGlobalIRQ();
+	bool		done	= afe->drdy_flag;
+
+	if ( done )
+	{
+		afe->drdy_flag		= false;
+	}
+	else
+	{
+		afe->drdy_waiter	= this;
+#ifndef	CPU_MCXC444VLH
+		timeout.attach( [ this ](){ expire(); }, drdy_timeout );
+#endif
+	}
+
+	EnableGlobalIRQ( primask );
+
+	return !done;
+}
+
+int AFE_base::drdy_awaiter::await_resume( void )
+{
+	if ( !timed_out )
+		return 0;
+
+	printf( "DRDY signal wait timeout\r\n" );
+	return -1;
+}
+
+void AFE_base::drdy_awaiter::expire( void )
+{
+	uint32_t	primask	= DisableGlobalIRQ();
+	bool		mine	= (afe->drdy_waiter == this);
+
+	if ( mine )
+		afe->drdy_waiter	= nullptr;
+
+	EnableGlobalIRQ( primask );
+
+	if ( !mine )
+		return;
+
+	timed_out	= true;
+	Scheduler::resume_later( node );
+}
+
 void AFE_base::use_DRDY_trigger( bool use )
 {
 	if ( use )
@@ -193,6 +293,75 @@ void AFE_base::use_DRDY_trigger( bool use )
 		set_DRDY_callback( nullptr );
 }
 
+void AFE_base::stream_start( int buffer_frames )
+{
+	set_DRDY_callback( nullptr );	//	detach first: old stream ISR must not read SPI or touch the buffer while changing
+	stop_conversion();
+
+	stream_buffer.resize( buffer_frames );
+	stream_head		= 0;
+	stream_tail		= 0;
+	stream_sequence	= 0;
+	stream_overrun	= 0;
+
+	set_DRDY_callback( [this](void){ stream_drdy_cb(); } );
+	start_continuous_conversion();
+}
+
+void AFE_base::stream_stop( void )
+{
+	set_DRDY_callback( nullptr );	//	detach first: stream ISR must not read SPI while the abort command is sent
+	stop_conversion();
+	use_DRDY_trigger( true );
+}
+
+void AFE_base::stream_drdy_cb( void )
+{
+	uint32_t	timestamp	= us_count();
+	uint32_t	head		= stream_head.load( std::memory_order_relaxed );
+	uint32_t	tail		= stream_tail.load( std::memory_order_acquire );
+
+	stream_sequence++;
+
+	if ( stream_buffer.size() <= head - tail )
+	{
+		stream_overrun	= stream_overrun + 1;
+		return;
+	}
+
+	frame&	f	= stream_buffer[ head % stream_buffer.size() ];
+
+	f.timestamp	= timestamp;
+	f.sequence	= stream_sequence;
+	read( f.data );
+
+	stream_head.store( head + 1, std::memory_order_release );
+}
+
+bool AFE_base::stream_read( frame& f )
+{
+	uint32_t	tail	= stream_tail.load( std::memory_order_relaxed );
+	uint32_t	head	= stream_head.load( std::memory_order_acquire );
+
+	if ( head == tail )
+		return false;
+
+	f	= stream_buffer[ tail % stream_buffer.size() ];
+	stream_tail.store( tail + 1, std::memory_order_release );
+
+	return true;
+}
+
+int AFE_base::stream_available( void )
+{
+	return stream_head.load( std::memory_order_acquire ) - stream_tail.load( std::memory_order_relaxed );
+}
+
+uint32_t AFE_base::stream_overruns( void )
+{
+	return stream_overrun;
+}
+
 
 AFE_base::callback_fp_t	AFE_base::cbf_DRDY		= nullptr;
 
@@ -389,6 +558,11 @@ void NAFE13388_Base::start_continuous_conversion( void )
 	command( CMD_MC );
 }
 
+void NAFE13388_Base::stop_conversion( void )
+{
+	command( CMD_ABORT );
+}
+
 void NAFE13388_Base::DRDY_by_sequencer_done( bool flag )
 {
 	bit_op( SYS_CONFIG0, ~0x0010, flag ? 0x0010 : 0x00 );
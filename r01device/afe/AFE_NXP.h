@@ -59,6 +59,7 @@
 #include	<variant>
 #include	<algorithm>
 #include	<functional>
+#include	<atomic>
 
 #define		NON_TEMPLATE_VERSION_FOR_START_AND_READ
 
@@ -90,7 +91,7 @@ public:
 	/** Issue RESET command */
 	virtual void reset( bool hardware_reset = false )	= 0;
 	
-	/** set callback function when DRDY comes */
+	/** set callback function when DRDY comes. Safe to call while DRDY interrupt is active */
 	using	callback_fp_t	= std::function<void(void)>;
 	virtual void set_DRDY_callback( callback_fp_t fnc );
 	
@@ -141,6 +142,10 @@ public:
 	 */
 	virtual void start_continuous_conversion( void )	= 0;
 
+	/** Stop AD conversion
+	 */
+	virtual void stop_conversion( void )				= 0;
+
 	/** DRDY event select
 	 *
 	 * @param set true for DRDY by sequencer is done
@@ -170,6 +175,15 @@ public:
 	 * @param ch logical channel number (0 ~ 15)
 	 */
 	virtual raw_t	start_and_read( int ch );
+
+	/** Start and read ADC for single channel, awaitable in Task (see Coroutine.h)
+	 *
+	 *	Other Tasks run while waiting for the conversion
+	 *
+	 * @param ch logical channel number (0 ~ 15)
+	 * @return Task giving ADC readout
+	 */
+	Task<raw_t>		start_and_read_async( int ch );
 	
 #ifdef	NON_TEMPLATE_VERSION_FOR_START_AND_READ
 
@@ -262,6 +276,50 @@ public:
 	 */
 	void	use_DRDY_trigger( bool use = true );
 
+	/** A frame of streaming data */
+	typedef struct	_frame	{
+		uint32_t	timestamp;		/**< us_count() at DRDY [us]. Keeps counting while the core sleeps */
+		uint32_t	sequence;		/**< DRDY count from stream_start(). Gap in the sequence shows dropped frames */
+		raw_t		data[ 16 ];		/**< ADC data of enabled logical channels in sequence order */
+	} frame;
+
+	/** Start streaming
+	 *
+	 *	Starts continuous conversion. On each DRDY, data of all enabled logical channels are read 
+	 *	by burst read in the interrupt and stored into a ring buffer with timestamp. 
+	 *	If the buffer is full, the frame is dropped and counted as overrun. 
+	 *	The ring buffer is lock-free single-producer (DRDY interrupt) / single-consumer (stream_read()). 
+	 *	DRDY_by_sequencer_done( true ) (default setting) is required.
+	 *
+	 * @param buffer_frames number of frames in ring buffer
+	 */
+	virtual void	stream_start( int buffer_frames = 16 );
+
+	/** Stop streaming
+	 *
+	 *	Detaches the stream DRDY callback, stops conversion and DRDY callback is set to default. Frames in buffer can be read after stop.
+	 */
+	virtual void	stream_stop( void );
+
+	/** Read a frame from ring buffer
+	 *
+	 * @param f frame to store
+	 * @return true if a frame is read, false if buffer is empty
+	 */
+	bool			stream_read( frame& f );
+
+	/** Number of frames in ring buffer
+	 *
+	 * @return number of frames available
+	 */
+	int				stream_available( void );
+
+	/** Number of dropped frames by buffer full
+	 *
+	 * @return overrun count from stream_start()
+	 */
+	uint32_t		stream_overruns( void );
+
 protected:
 	bool			highspeed_variant;
 	InterruptIn		pin_nINT;
@@ -295,8 +353,37 @@ protected:
 	volatile bool	drdy_flag;
 
 	constexpr static uint32_t	timeout_limit	= 100000000;
+	constexpr static float		drdy_timeout	= 1.0;
 
 	static callback_fp_t	cbf_DRDY;
+
+	std::vector<frame>		stream_buffer;
+	std::atomic<uint32_t>	stream_head;
+	std::atomic<uint32_t>	stream_tail;
+	uint32_t				stream_sequence;
+	volatile uint32_t		stream_overrun;
+
+	void					stream_drdy_cb( void );
+
+	/** Awaiter for DRDY. Gives 0, or -1 if no DRDY in drdy_timeout (no timeout on MCXC444) */
+	struct drdy_awaiter
+	{
+		drdy_awaiter( AFE_base *afe_ptr ) : afe( afe_ptr ) {}
+
+		AFE_base			*afe;
+		bool				timed_out	= false;
+		Scheduler::Ready	node;
+#ifndef	CPU_MCXC444VLH
+		Timeout				timeout;
+#endif
+
+		bool	await_ready( void );
+		bool	await_suspend( std::coroutine_handle<> handle );
+		int		await_resume( void );
+		void	expire( void );
+	};
+
+	drdy_awaiter * volatile	drdy_waiter;
 public:
 	virtual void			init( void );
 protected:
@@ -304,6 +391,7 @@ protected:
 	
 	static void				DRDY_cb( void );
 	int						wait_conversion_complete( double delay = -1.0 );
+	Task<int>				wait_conversion_complete_async( double delay = -1.0 );
 
 };
 
@@ -426,6 +514,10 @@ public:
 	 */
 	virtual void start_continuous_conversion();
 
+	/** Stop AD conversion
+	 */
+	virtual void stop_conversion( void );
+
 	/** DRDY event select
 	 *
 	 * @param set true for DRDY by sequencer is done
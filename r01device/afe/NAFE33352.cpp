@@ -392,6 +392,11 @@ void NAFE33352_Base::start_continuous_conversion( void )
 	command( CMD_MC );
 }
 
+void NAFE33352_Base::stop_conversion( void )
+{
+	command( CMD_ADC_ABORT );
+}
+
 void NAFE33352_Base::DRDY_by_sequencer_done( bool flag )
 {
 	bit_op( AI_SYSCFG, ~0x0100, flag ? 0x0100 : 0x0000 );	
@@ -190,6 +190,10 @@ public:
 	 */
 	virtual void start_continuous_conversion();
 
+	/** Stop AD conversion
+	 */
+	virtual void stop_conversion( void );
+
 	/** DRDY event select
 	 *
 	 * @param set true for DRDY by sequencer is done
@@ -19,14 +19,9 @@ SPI_for_AFE::~SPI_for_AFE()
 
 void SPI_for_AFE::txrx( uint8_t *data, int size )
 {
-	static constexpr int	READ_BUFFER_SIZE	= command_length + 16 * 3; //	(2[command] + 16[logical_channels] * 3[bytes])
-
-	uint8_t	r_data[ READ_BUFFER_SIZE ];
-	
 	data[ 0 ]	|= dev_ad ? 0x80 : 0x00;
 	
-	_spi.write( data, r_data, size );
-	memcpy( data, r_data, size );
+	_spi.transfer( data, size );
 }
 
 void SPI_for_AFE::write_r16( uint16_t reg )
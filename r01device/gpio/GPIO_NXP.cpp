@@ -61,8 +61,8 @@ void GPIO_base::output( int port, uint8_t value, uint8_t mask )
 {
 	if ( mask )
 		intfp->bit_op8( *(arp + OUT) + port, mask, value );
-
-	intfp->write_r8( *(arp + OUT) + port, value );
+	else
+		intfp->write_r8( *(arp + OUT) + port, value );
 }
 
 void GPIO_base::output( const uint8_t *vp )
@@ -86,8 +86,8 @@ void GPIO_base::config( int port, uint8_t config, uint8_t mask )
 {
 	if ( mask )
 		intfp->bit_op8( *(arp + CONFIG) + port, mask, config );
-
-	intfp->write_r8( *(arp + CONFIG) + port, config );
+	else
+		intfp->write_r8( *(arp + CONFIG) + port, config );
 }
 
 void GPIO_base::config( const uint8_t* vp )
@@ -190,6 +190,20 @@ uint16_t GPIO_base::read_port16( access_word w, int port_num )
 	return intfp->read_r16( *(arp + w) + port_num );
 }
 
+void GPIO_base::shadow_enable( bool enable )
+{
+	intfp->shadow_config( ~auto_increment );
+	intfp->shadow_enable( enable );
+
+	if ( !enable )
+		return;
+
+	intfp->shadow_volatile( *(arp + IN), n_ports );
+
+	if ( 0xFF != *(arp + INT_STATUS) )
+		intfp->shadow_volatile( *(arp + INT_STATUS), n_ports );
+}
+
 void GPIO_base::print_bin( uint8_t v )
 {
 	PRINTF( " 0b" );
@@ -222,6 +222,15 @@ public:
 	 */
 	uint16_t	read_port16( access_word w, int port_num = 0 );
 
+	/** Register shadow enable
+	 *
+	 *	Output, configuration and other setting registers are served from RAM. 
+	 *	It eliminates reads for output() and config() with mask. Input and interrupt status are read from device
+	 *
+	 * @param enable true to enable
+	 */
+	void		shadow_enable( bool enable = true );
+
 	static void	print_bin( uint8_t v );
 	
 	void init( void );
@@ -24,6 +24,7 @@ int GPIO_SPI::reg_w( uint8_t reg_adr, const uint8_t *data, uint16_t size )
 	memcpy( w_data + 2, data, size );
 	
 	spi.write( w_data, r_data, size + 2 );
+	shadow_store( reg_adr, data, size );
 	
 	return size;
 }
@@ -38,12 +39,16 @@ int GPIO_SPI::reg_w( uint8_t reg_adr, uint8_t data )
 	w_data[ 2 ]	= data;
 	
 	spi.write( w_data, r_data, 3 );
+	shadow_store( reg_adr, &data, 1 );
 	
 	return 1;
 }
 
 int GPIO_SPI::reg_r( uint8_t reg_adr, uint8_t *data, uint16_t size )
 {
+	if ( shadow_load( reg_adr, data, size ) )
+		return size;
+
 	uint8_t	w_data[ size + 2 ]	= { 0 };
 	uint8_t	r_data[ size + 2 ];
 
@@ -53,6 +58,7 @@ int GPIO_SPI::reg_r( uint8_t reg_adr, uint8_t *data, uint16_t size )
 	spi.write( w_data, r_data, size + 2 );
 	
 	memcpy( data, r_data + 2, size );
+	shadow_store( reg_adr, data, size );
 
 	return size;
 }
@@ -62,11 +68,15 @@ uint8_t GPIO_SPI::reg_r( uint8_t reg_adr )
 	uint8_t	w_data[ 3 ];
 	uint8_t	r_data[ 3 ];
 	
+	if ( shadow_load( reg_adr, r_data + 2, 1 ) )
+		return r_data[ 2 ];
+	
 	w_data[ 0 ]	= (dev_addr << 1) | 0x1;
 	w_data[ 1 ]	= reg_adr;
 	w_data[ 2 ]	= 0;
 	
 	spi.write( w_data, r_data, 3 );
+	shadow_store( reg_adr, r_data + 2, 1 );
 	
 	return r_data[ 2 ];
 } 
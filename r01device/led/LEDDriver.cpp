@@ -146,10 +146,7 @@ PCA995x_SPI::~PCA995x_SPI()
 
 void PCA995x_SPI::txrx( uint8_t *data, int size )
 {
-	uint8_t	r_data[ 128 ];
-	
-	spi.write( data, r_data, size );
-	memcpy( data, r_data, size );
+	spi.transfer( data, size );
 }
 
 void PCA995x_SPI::reg_access( uint8_t reg, uint8_t val )
@@ -168,8 +165,8 @@ void PCA995x_SPI::reg_access( uint8_t reg, uint8_t *vp, int len )
 		data[ i * 2 + 1 ]	= vp[ i ];
 	}
 	
-	for ( int i = 0; i < len * 2; i += 2 )
-		txrx( data + i, 2 );
+	//	each register access needs CS toggle. all accesses are sent in one call
+	spi.write_frames( data, data, len * 2, 2 );
 }
 
 uint8_t PCA995x_SPI::reg_access( uint8_t reg )
@@ -185,8 +182,20 @@ uint8_t PCA995x_SPI::reg_access( uint8_t reg )
 
 void PCA995x_SPI::reg_access_r( uint8_t reg, uint8_t *vp, int len )
 {
+	uint8_t data[ (len + 1) * 2 ];
+	
+	//	read data comes out in next frame. next read command is sent in the frame to pipeline the reads
+	for ( int i = 0; i < len; i++ ) {
+		data[ i * 2 + 0 ]	= ((reg + i) << 1) | 0x01;
+		data[ i * 2 + 1 ]	= 0xFF;
+	}
+	data[ len * 2 + 0 ]	= 0xFF;
+	data[ len * 2 + 1 ]	= 0xFF;
+	
+	spi.write_frames( data, data, (len + 1) * 2, 2 );
+
 	for ( int i = 0; i < len; i++ ) {
-		*vp++	= reg_access( reg + i );
+		*vp++	= data[ (i + 1) * 2 + 1 ];
 	}
 }
 
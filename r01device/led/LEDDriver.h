@@ -10,6 +10,7 @@
 #include "r01lib.h"
 #include "I2C_device.h"
 #include <stdint.h>
+#include <vector>
 
 #ifdef	CPU_MCXN947VDF
 	#undef	PWM0	//	To avoid name conflicts with MCXN947_cm33_core0.h
@@ -642,4 +643,117 @@ public:
 
 };
 
+
+/** PCA9957_Chain class
+ *	
+ *  @class PCA9957_Chain
+ *
+ *	Daisy-chained PCA9957s on one SPI chip-select. 
+ *	SDO of each device is connected to SDI of next device. Device 0 is the one which SDI is connected to MCU. 
+ *	Each SPI frame carries 16 bit commands for all devices and those are executed at the rising edge of CS. 
+ *	PWM values of all devices are kept in a frame buffer and updated by 24 SPI frames, independent from number of devices. 
+ *
+ *	Example:
+ *	@code
+ *	SPI				spi( D11, D12, D13, D10 );
+ *	PCA9957_Chain	leds( spi, 8 );
+ *	
+ *	leds.init( 0.1 );
+ *	
+ *	while ( true )
+ *	{
+ *		uint8_t	*fp	= leds.frame();	//	8 devices * 24 channels
+ *		render( fp );
+ *		leds.flush();
+ *	}
+ *	@endcode
+ */
+
+class PCA9957_Chain
+{
+public:
+	/** Create a PCA9957_Chain instance
+	 *
+	 * @param interface SPI instance
+	 * @param n_devices number of devices in the chain
+	 */
+	PCA9957_Chain( SPI& interface, int n_devices );
+	virtual ~PCA9957_Chain();
+
+	/** Initializing all devices
+	 *
+	 * @param current current value in float (0.0 ~ 1.0)
+	 */
+	void init( float current );
+
+	/** Register write, same value to all devices
+	 *
+	 * @param reg register index/address/pointer
+	 * @param val data value
+	 */
+	void write_r8( uint8_t reg, uint8_t val );
+
+	/** Register write, value for each device
+	 *
+	 * @param reg register index/address/pointer
+	 * @param vals data values, in order of device number
+	 */
+	void write_r8_each( uint8_t reg, const uint8_t *vals );
+
+	/** Register read from all devices
+	 *
+	 * @param reg register index/address/pointer
+	 * @param vals buffer for read data, in order of device number
+	 */
+	void read_r8( uint8_t reg, uint8_t *vals );
+
+	/** Set IREFALL value of all devices
+	 *
+	 * @param iref current value (0 ~ 255)
+	 */
+	void irefall( uint8_t iref );
+
+	/** Frame buffer of PWM values
+	 *
+	 *	n_devices * 24 bytes. Value of channel "ch" on device "dev" is at [ dev * 24 + ch ]. 
+	 *	Changes are sent to devices by flush(). 
+	 *
+	 * @return pointer to the frame buffer
+	 */
+	uint8_t* frame( void );
+
+	/** Set PWM value in frame buffer
+	 *
+	 * @param dev device number
+	 * @param ch channel number
+	 * @param value	PWM value in float. Values should be in range from 0.0 to 1.0.
+	 */
+	void pwm( int dev, int ch, float value );
+
+	/** Set PWM value for all channels of all devices and flush
+	 *
+	 * @param *values Pointer to n_devices * 24 PWM values in float. Values should be in range from 0.0 to 1.0.
+	 */
+	void pwm( float* values );
+
+	/** Send frame buffer to all devices
+	 *
+	 *	24 frames of n_devices * 16 bits are sent by one SPI::write_frames() call. 
+	 *	On LPSPI, frames are sent without CPU intervention if n_devices is 1 or even number. 
+	 */
+	void flush( void );
+
+	/** Number of devices */
+	const int	n_devices;
+
+private:
+	void		command( const uint8_t *cmds, const uint8_t *vals, uint8_t *rp = nullptr );
+
+	SPI&					spi;
+	std::vector<uint8_t>	frame_buffer;
+	std::vector<uint8_t>	tx_buffer;
+	std::vector<uint8_t>	cmd_buffer;
+	std::vector<uint8_t>	val_buffer;
+};
+
 #endif //	ARDUINO_LED_DRIVER_NXP_ARD_H
@@ -4,6 +4,8 @@
  *  Released under the MIT license License
  */
 
+#include	<algorithm>
+
 #include	"led/LEDDriver.h"
 
 /* PCA9957 class ******************************************/
@@ -29,3 +31,117 @@ void PCA9957::init( float current )
 }
 
 constexpr uint8_t PCA9957::access_ref[];
+
+
+/* PCA9957_Chain class ******************************************/
+PCA9957_Chain::PCA9957_Chain( SPI& interface, int n_dev ) : 
+	n_devices( n_dev ), spi( interface ), frame_buffer( n_dev * PCA9957::n_channel, 0 ), tx_buffer( n_dev * 2 * PCA9957::n_channel ), cmd_buffer( n_dev ), val_buffer( n_dev )
+{
+}
+
+PCA9957_Chain::~PCA9957_Chain()
+{
+}
+
+void PCA9957_Chain::init( float current )
+{
+	write_r8( PCA9957::MODE2,  0x18 );
+	write_r8( PCA9957::PWMALL, 0x00 );
+
+	for ( int i = 0; i < 6; i++ )
+		write_r8( PCA9957::LEDOUT0 + i, 0xAA );
+	
+	irefall( (uint8_t)(current * 255.0) );
+
+	std::fill( frame_buffer.begin(), frame_buffer.end(), 0 );
+}
+
+void PCA9957_Chain::command( const uint8_t *cmds, const uint8_t *vals, uint8_t *rp )
+{
+	uint8_t	*bp	= tx_buffer.data();
+
+	//	first word goes to the farthest device
+	for ( int i = 0; i < n_devices; i++ )
+	{
+		int	dev	= n_devices - 1 - i;
+
+		bp[ i * 2 + 0 ]	= cmds[ dev ];
+		bp[ i * 2 + 1 ]	= vals ? vals[ dev ] : 0xFF;
+	}
+
+	spi.transfer( bp, n_devices * 2 );
+
+	if ( rp )
+		for ( int i = 0; i < n_devices; i++ )
+			rp[ n_devices - 1 - i ]	= bp[ i * 2 + 1 ];
+}
+
+void PCA9957_Chain::write_r8( uint8_t reg, uint8_t val )
+{
+	std::fill( cmd_buffer.begin(), cmd_buffer.end(), reg << 1 );
+	std::fill( val_buffer.begin(), val_buffer.end(), val );
+
+	command( cmd_buffer.data(), val_buffer.data() );
+}
+
+void PCA9957_Chain::write_r8_each( uint8_t reg, const uint8_t *vals )
+{
+	std::fill( cmd_buffer.begin(), cmd_buffer.end(), reg << 1 );
+
+	command( cmd_buffer.data(), vals );
+}
+
+void PCA9957_Chain::read_r8( uint8_t reg, uint8_t *vals )
+{
+	std::fill( cmd_buffer.begin(), cmd_buffer.end(), (reg << 1) | 0x01 );
+	command( cmd_buffer.data(), nullptr );
+
+	//	read data comes out in next frame
+	std::fill( cmd_buffer.begin(), cmd_buffer.end(), 0xFF );
+	command( cmd_buffer.data(), nullptr, vals );
+}
+
+void PCA9957_Chain::irefall( uint8_t iref )
+{
+	write_r8( PCA9957::IREFALL, iref );
+}
+
+uint8_t* PCA9957_Chain::frame( void )
+{
+	return frame_buffer.data();
+}
+
+void PCA9957_Chain::pwm( int dev, int ch, float value )
+{
+	frame_buffer[ dev * PCA9957::n_channel + ch ]	= (uint8_t)(value * 255.0);
+}
+
+void PCA9957_Chain::pwm( float* values )
+{
+	for ( int i = 0; i < n_devices * PCA9957::n_channel; i++ )
+		frame_buffer[ i ]	= (uint8_t)(values[ i ] * 255.0);
+
+	flush();
+}
+
+void PCA9957_Chain::flush( void )
+{
+	uint8_t	*bp		= tx_buffer.data();
+	int		length	= n_devices * 2;
+
+	//	one SPI frame per channel, carrying the channel value for all devices
+	for ( int ch = 0; ch < PCA9957::n_channel; ch++ )
+	{
+		uint8_t	*fp	= bp + ch * length;
+
+		for ( int i = 0; i < n_devices; i++ )
+		{
+			int	dev	= n_devices - 1 - i;
+
+			fp[ i * 2 + 0 ]	= (PCA9957::PWM0 + ch) << 1;
+			fp[ i * 2 + 1 ]	= frame_buffer[ dev * PCA9957::n_channel + ch ];
+		}
+	}
+
+	spi.write_frames( bp, bp, length * PCA9957::n_channel, length );
+}
@@ -178,3 +178,17 @@ void PCF2131::periodic_interrupt_enable( periodic_int_select sel, int int_sel )
 	intfp->bit_op8( Control_1, ~0x03, v );
 	intfp->bit_op8( int_mask_reg[ int_sel ][ 0 ], ~0x30, ~(v << 4) );
 }
+
+void PCF2131::shadow_enable( bool enable )
+{
+	intfp->shadow_enable( enable );
+
+	if ( !enable )
+		return;
+
+	intfp->shadow_volatile( Control_2, 3 );								//	interrupt flags
+	intfp->shadow_volatile( SR_Reset );
+	intfp->shadow_volatile( _100th_Seconds, Years - _100th_Seconds + 1 );
+	intfp->shadow_volatile( Timestp_ctl1, Year_timestp4 - Timestp_ctl1 + 1 );
+	intfp->shadow_volatile( Watchdg_tim_val );
+}
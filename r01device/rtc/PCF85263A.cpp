@@ -158,3 +158,17 @@ time_t PCF85263A::timestamp( int num )
 
 	
 }
+
+void PCF85263A::shadow_enable( bool enable )
+{
+	I2C_device::shadow_enable( enable );
+
+	if ( !enable )
+		return;
+
+	shadow_volatile( _100th_seconds, Years - _100th_seconds + 1 );
+	shadow_volatile( TSR1_seconds, TSR3_years - TSR1_seconds + 1 );
+	shadow_volatile( Flags );
+	shadow_volatile( WatchDog );
+	shadow_volatile( Resets );
+}
@@ -331,6 +331,15 @@ public:
 	 */
 	void periodic_interrupt_enable( periodic_int_select sel, int int_sel = 0 );
 
+	/** Register shadow enable
+	 *
+	 *	Control, alarm and interrupt mask registers are served from RAM. 
+	 *	Reduces bus transactions for alarm and interrupt settings
+	 *
+	 * @param enable true to enable
+	 */
+	void shadow_enable( bool enable = true );
+
 private:
 	const int int_mask_reg[ 2 ][ 2 ]	= {
 		{ INT_A_MASK1, INT_A_MASK2, },
@@ -862,6 +871,15 @@ public:
 	 */
 	time_t timestamp( int num );
 
+	/** Register shadow enable
+	 *
+	 *	Control, alarm and interrupt enable registers are served from RAM. 
+	 *	Reduces bus transactions for alarm and interrupt settings
+	 *
+	 * @param enable true to enable
+	 */
+	virtual void shadow_enable( bool enable = true ) override;
+
 #if DOXYGEN_ONLY
 	/** time
 	 * 
@@ -11,10 +11,7 @@ SPI_for_RTC::~SPI_for_RTC() {}
 
 void SPI_for_RTC::txrx( uint8_t *data, int size )
 {
-	uint8_t	r_data[ size ];
-	
-	spi.write( data, r_data, size );
-	memcpy( data, r_data, size );
+	spi.transfer( data, size );
 }
 
 int SPI_for_RTC::reg_w( uint8_t reg_adr, const uint8_t *data, uint16_t size )
@@ -25,6 +22,7 @@ int SPI_for_RTC::reg_w( uint8_t reg_adr, const uint8_t *data, uint16_t size )
 	memcpy( v + 1, data, size );
 	
 	txrx( v, sizeof( v ) );
+	shadow_store( reg_adr, data, size );
 	
 	return 0;
 }
@@ -34,12 +32,16 @@ int SPI_for_RTC::reg_w( uint8_t reg_adr, uint8_t data )
 	uint8_t	v[]	= { reg_adr, data };
 	
 	txrx( v, sizeof( v ) );
+	shadow_store( reg_adr, &data, 1 );
 
 	return 0;
 }
 
 int SPI_for_RTC::reg_r( uint8_t reg_adr, uint8_t *data, uint16_t size )
 {
+	if ( shadow_load( reg_adr, data, size ) )
+		return 0;
+
 	uint8_t	v[ size + 1 ];
 	
 	for ( int i = 0; i < size + 1; i++ ) v[ i ]	= 0xFF;
@@ -49,6 +51,7 @@ int SPI_for_RTC::reg_r( uint8_t reg_adr, uint8_t *data, uint16_t size )
 	txrx( v, sizeof( v ) );
 	
 	memcpy( data, v + 1, size );
+	shadow_store( reg_adr, data, size );
 
 	return 0;
 }
@@ -57,7 +60,11 @@ uint8_t	SPI_for_RTC::reg_r( uint8_t reg_adr )
 {
 	uint8_t	v[]	= { (uint8_t)(reg_adr | 0x80), 0xFF };
 	
+	if ( shadow_load( reg_adr, v + 1, 1 ) )
+		return v[ 1 ];
+
 	txrx( v, sizeof( v ) );
+	shadow_store( reg_adr, v + 1, 1 );
 	
 	return v[ 1 ];
 }
@@ -33,6 +33,14 @@ TempSensor::operator float()
 	return temp();
 }
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+bool TempSensor::one_shot( one_shot_t& setting )
+{
+	return false;
+}
+#pragma GCC diagnostic pop
+
 
 /* LM75B class ******************************************/
 
@@ -58,10 +66,24 @@ void LM75B::os_mode( mode flag )
 	bit_op8( Conf, ~0x02, flag << 1 );
 }
 
+void LM75B::shadow_enable( bool enable )
+{
+	shadow_config( 0x03, 2 );	//	2 bit pointer, 16 bit registers without address increment
+	TempSensor::shadow_enable( enable );
+	shadow_volatile( Temp );
+}
+
 /* PCT2075 class ******************************************/
 PCT2075::PCT2075( I2C& interface, uint8_t i2c_address ) : LM75B( interface, i2c_address ){}
 PCT2075::~PCT2075(){}
 
+void PCT2075::shadow_enable( bool enable )
+{
+	shadow_config( 0x07, 2 );	//	3 bit pointer to cover Tidle
+	TempSensor::shadow_enable( enable );
+	shadow_volatile( Temp );
+}
+
 /* P3T1755 class ******************************************/
 
 P3T1755::P3T1755( I2C& interface, uint8_t i2c_address ) : LM75B( interface, i2c_address ){}
@@ -76,6 +98,25 @@ void P3T1755::thresholds( float v0, float v1 )
 	write_r16( T_LOW,  ((uint16_t)(lower  * 256.0)) & 0xFFF0 );
 }
 
+void P3T1755::shadow_enable( bool enable )
+{
+	LM75B::shadow_enable( enable );
+	shadow_volatile( Conf );
+}
+
+bool P3T1755::one_shot( one_shot_t& setting )
+{
+	uint8_t	conf	= read_r8( Conf );
+
+	setting.reg				= Conf;
+	setting.trigger[ 0 ]	= conf | 0x81;	//	OS and SD bits
+	setting.restore[ 0 ]	= conf;
+	setting.length			= 1;
+	setting.conversion_us	= 27500 << ((conf >> 5) & 0x3);	//	R1:R0 bits: 27.5, 55, 110 or 220 ms
+
+	return true;
+}
+
 /* P3T1085 class ******************************************/
 
 P3T1085::P3T1085( I2C& interface, uint8_t i2c_address ) : P3T1755( interface, i2c_address ){}
@@ -90,6 +131,14 @@ bool P3T1085::clear( void )
 	return (read_r16( Conf ) & 0x1000) ? true : false;
 }
 
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+bool P3T1085::one_shot( one_shot_t& setting )
+{
+	return false;
+}
+#pragma GCC diagnostic pop
+
 /* P3T1035 class ******************************************/
 
 P3T1035::P3T1035( I2C& interface, uint8_t i2c_address ) : P3T1755( interface, i2c_address ){}
@@ -101,6 +150,11 @@ void P3T1035::os_mode( mode flag )
 {
 	//	Do nothing since this device doesn't have "Thermostat Mode"
 }
+
+bool P3T1035::one_shot( one_shot_t& setting )
+{
+	return false;
+}
 #pragma GCC diagnostic pop
 
 /* P3T2030 class ******************************************/
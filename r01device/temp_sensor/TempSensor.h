@@ -58,6 +58,26 @@ public:
 	 */
 	operator	float();
 	
+	/** Register writes to start a single conversion */
+	struct one_shot_t {
+		uint8_t	reg;			/**< register to write	*/
+		uint8_t	trigger[ 2 ];	/**< data to start a conversion	*/
+		uint8_t	restore[ 2 ];	/**< data to get back to the setting before trigger	*/
+		int		length;			/**< data length in bytes	*/
+		int		conversion_us;	/**< conversion time in micro-seconds	*/
+	};
+
+	/** One-shot setting
+	 *
+	 *	Gives register writes for triggering a conversion instead of performing it. 
+	 *	I3CBus::sample_all() uses this to trigger all sensors back to back. 
+	 *	Default implementation returns false (no one-shot available)
+	 *
+	 * @param setting structure to be filled
+	 * @return true if the sensor has one-shot
+	 */
+	virtual bool one_shot( one_shot_t& setting );
+	
 private:	
 	virtual int16_t	read_Temp_register( void ) = 0;
 };
@@ -108,6 +128,14 @@ public:
 	 */	
 	virtual void os_mode( mode flag );
 	
+	/** Register shadow enable
+	 *
+	 *	Conf, Thyst and Tos registers are served from RAM
+	 *
+	 * @param enable true to enable
+	 */
+	virtual void shadow_enable( bool enable = true ) override;
+
 private:
 	virtual int16_t read_Temp_register( void ) override;
 	
@@ -231,6 +259,14 @@ public:
      */
 	virtual ~PCT2075();
 
+	/** Register shadow enable
+	 *
+	 *	Conf, Thyst, Tos and Tidle registers are served from RAM
+	 *
+	 * @param enable true to enable
+	 */
+	virtual void shadow_enable( bool enable = true ) override;
+
 #if DOXYGEN_ONLY
 	/** Get temperature value in degree Celsius [°C] 
 	 *
@@ -347,6 +383,24 @@ public:
 	 */	
 	virtual void thresholds( float v0, float v1 ) override;
 
+	/** Register shadow enable
+	 *
+	 *	T_LOW and T_HIGH registers are served from RAM. Conf is read from device since it has flags
+	 *
+	 * @param enable true to enable
+	 */
+	virtual void shadow_enable( bool enable = true ) override;
+
+	/** One-shot setting
+	 *
+	 *	Trigger sets SD and OS bits in Conf. Restore writes current Conf back to get continuous conversion again. 
+	 *	Conversion time is taken from R1:R0 bits in Conf
+	 *
+	 * @param setting structure to be filled
+	 * @return true
+	 */
+	virtual bool one_shot( one_shot_t& setting ) override;
+
 #if DOXYGEN_ONLY
 	/** Get temperature value in degree Celsius [°C] 
 	 *
@@ -447,6 +501,15 @@ public:
 	 */
 	virtual bool clear( void );
 
+	/** One-shot setting
+	 *
+	 *	Conf layout differs from P3T1755. No one-shot is given
+	 *
+	 * @param setting not used
+	 * @return false
+	 */
+	virtual bool one_shot( one_shot_t& setting ) override;
+
 #if DOXYGEN_ONLY
 	/** Get temperature value in degree Celsius [°C] 
 	 *
@@ -541,6 +604,15 @@ public:
 	 */	
 	virtual void os_mode( mode flag );	
 
+	/** One-shot setting
+	 *
+	 *	Conf layout differs from P3T1755. No one-shot is given
+	 *
+	 * @param setting not used
+	 * @return false
+	 */
+	virtual bool one_shot( one_shot_t& setting ) override;
+
 #if DOXYGEN_ONLY
 	/** Get temperature value in degree Celsius [°C] 
 	 *
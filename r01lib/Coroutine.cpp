@@ -0,0 +1,111 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+#include	"Coroutine.h"
+#include	"EventQueue.h"
+#include	"mcu.h"
+
+int					Scheduler::tasks		= 0;
+Scheduler::Ready	*Scheduler::ready_head	= nullptr;
+Scheduler::Ready	**Scheduler::ready_tail	= &Scheduler::ready_head;
+
+static void resume_event( void *context, uint32_t )
+{
+	std::coroutine_handle<>::from_address( context ).resume();
+}
+
+void Scheduler::spawn( Task<void>&& task )
+{
+	tasks++;
+	resume_later( task.release() );
+}
+
+void Scheduler::run( void )
+{
+	EventQueue&	queue	= EventQueue::shared();
+
+	while ( tasks )
+	{
+		queue.dispatch();
+		resume_ready();
+
+		//	sleep with interrupts masked to not miss an event posted right before WFI
+		uint32_t	primask	= DisableGlobalIRQ();
+
+		if ( tasks && !queue.pending() && !ready_head )
+			__WFI();
+
+		EnableGlobalIRQ( primask );
+	}
+}
+
+int Scheduler::active( void )
+{
+	return tasks;
+}
+
+void Scheduler::resume_later( Ready& node )
+{
+	if ( EventQueue::shared().post( resume_event, node.handle.address(), 0, EventQueue::Normal ) )
+		return;
+
+	//	queue is full. the node in suspended awaiter is linked instead, no allocation
+	uint32_t	primask	= DisableGlobalIRQ();
+
+	node.next	= nullptr;
+	*ready_tail	= &node;
+	ready_tail	= &node.next;
+
+	EnableGlobalIRQ( primask );
+}
+
+void Scheduler::resume_later( std::coroutine_handle<> handle )
+{
+	if ( !EventQueue::shared().post( resume_event, handle.address(), 0, EventQueue::Normal ) )
+		panic( "Scheduler: EventQueue overflow" );
+}
+
+void Scheduler::resume_ready( void )
+{
+	while ( true )
+	{
+		uint32_t	primask	= DisableGlobalIRQ();
+		Ready		*node	= ready_head;
+
+		if ( node )
+		{
+			ready_head	= node->next;
+
+			if ( !ready_head )
+				ready_tail	= &ready_head;
+		}
+
+		EnableGlobalIRQ( primask );
+
+		if ( !node )
+			return;
+
+		//	node is a part of the awaiter, it can be gone after resume
+		node->handle.resume();
+	}
+}
+
+void Scheduler::finished( void )
+{
+	tasks--;
+}
+
+void Scheduler::Sleep::await_suspend( std::coroutine_handle<> handle )
+{
+	node.handle	= handle;
+
+#ifdef	CPU_MCXC444VLH
+	wait( delay );
+	resume_later( node );
+#else
+	timeout.attach( [ this ](){ resume_later( node ); }, delay );
+#endif
+}
@@ -0,0 +1,375 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/** Stackless coroutines (C++20) for non-blocking device access
+ *
+ *	Task is a coroutine type which can co_await bus transfers, timers and other Tasks.
+ *	Scheduler runs spawned Tasks on one core without RTOS. Tasks are resumed from EventQueue::shared(),
+ *	so completion interrupts only post events and the coroutine code runs in the main loop.
+ *	If the queue is full, awaiters link their Scheduler::Ready node to a ready list which is drained in Scheduler::run().
+ *	Awaitable bus transfers are given as free functions (co_transfer(), co_reg_read() and co_reg_write()), 
+ *	so the bus classes do not depend on the scheduler.
+ *
+ *	Example:
+ *	@code
+ *	Task<void> poll_afe( NAFE13388& afe )
+ *	{
+ *		while ( true )
+ *		{
+ *			NAFE13388::raw_t	v	= co_await afe.start_and_read_async( 0 );
+ *			printf( "%ld\r\n", v );
+ *			co_await Scheduler::sleep( 0.1 );
+ *		}
+ *	}
+ *
+ *	Task<void> poll_temp( I2C& i2c )
+ *	{
+ *		uint8_t	buf[ 2 ];
+ *
+ *		while ( true )
+ *		{
+ *			if ( kStatus_Success == co_await co_reg_read( i2c, 0x48, 0x00, buf, sizeof( buf ) ) )
+ *				printf( "%d\r\n", (int8_t)buf[ 0 ] );
+ *			co_await Scheduler::sleep( 1.0 );
+ *		}
+ *	}
+ *
+ *	Scheduler::spawn( poll_afe( afe ) );
+ *	Scheduler::spawn( poll_temp( i2c ) );
+ *	Scheduler::run();
+ *	@endcode
+ */
+
+#ifndef R01LIB_COROUTINE_H
+#define R01LIB_COROUTINE_H
+
+extern "C" {
+#include	"fsl_common.h"
+}
+
+#include	<coroutine>
+#include	<exception>
+#include	<functional>
+#include	<utility>
+
+#ifndef	CPU_MCXC444VLH
+#include	"Ticker.h"
+#endif
+#include	"i2c.h"
+#include	"spi.h"
+
+template<typename T>	class Task;
+
+/** Scheduler class
+ *
+ *  @class Scheduler
+ *
+ *	Single-threaded scheduler for Tasks. Ready coroutines are queued in EventQueue::shared().
+ */
+class Scheduler
+{
+public:
+	/** Start a Task. The Task runs until its end without the caller awaiting it
+	 *
+	 * @param task Task to run
+	 */
+	static void	spawn( Task<void>&& task );
+
+	/** Run spawned Tasks until all of them finish
+	 *
+	 *	The core sleeps by WFI while no event is queued.
+	 *	Calling EventQueue::shared().dispatch() in application's loop also runs Tasks
+	 *	but Tasks in the ready list (queued while EventQueue was full) are resumed only in this function
+	 */
+	static void	run( void );
+
+	/** Number of spawned Tasks which have not finished
+	 *
+	 * @return number of Tasks
+	 */
+	static int	active( void );
+
+	/** Node to queue a coroutine without allocation. Held by an awaiter while its coroutine is suspended */
+	struct Ready
+	{
+		std::coroutine_handle<>	handle;
+		Ready					*next	= nullptr;
+	};
+
+	/** Queue a coroutine to be resumed. Can be called in interrupt context
+	 *
+	 *	If EventQueue::shared() is full, the node is linked to the ready list and resumed in run().
+	 *	A node must not be queued again before its coroutine is resumed
+	 *
+	 * @param node node which has the coroutine to be resumed
+	 */
+	static void	resume_later( Ready& node );
+
+	/** Queue a coroutine to be resumed. Can be called in interrupt context
+	 *
+	 *	This panics if EventQueue::shared() is full. Awaiters should use resume_later( Ready& )
+	 *
+	 * @param handle coroutine to be resumed
+	 */
+	static void	resume_later( std::coroutine_handle<> handle );
+
+	/** Awaitable for delay */
+	class Sleep
+	{
+	public:
+		Sleep( float sec ) : delay( sec ) {}
+		bool	await_ready( void ) { return delay <= 0.0; }
+		void	await_suspend( std::coroutine_handle<> handle );
+		void	await_resume( void ) {}
+
+	private:
+		float	delay;
+		Ready	node;
+#ifndef	CPU_MCXC444VLH
+		Timeout	timeout;
+#endif
+	};
+
+	/** Delay in a Task
+	 *
+	 *	co_await Scheduler::sleep( 0.1 );
+	 *	On MCXC444, which has no Ticker, this blocks
+	 *
+	 * @param sec delay
+	 * @return awaitable
+	 */
+	static Sleep	sleep( float sec ) { return Sleep( sec ); }
+
+	/** Called when a spawned Task finished. For internal use */
+	static void	finished( void );
+
+private:
+	static void	resume_ready( void );
+
+	static int				tasks;
+	static Ready			*ready_head;
+	static Ready			**ready_tail;
+};
+
+/** Awaitable for callback based non-blocking APIs
+ *
+ *	The start function is called with a completion callback and returns status of start.
+ *	co_await gives status_t of the operation.
+ *	If the start failed, the coroutine is not suspended and the status is given.
+ *
+ *	@code
+ *	status_t	s	= co_await async_op( [&]( auto cb ){ return spi.transfer_async( tx, rx, 4, cb ); } );
+ *	@endcode
+ */
+template<typename F>
+class AsyncOp
+{
+public:
+	AsyncOp( F start_func ) : start( start_func ), result( kStatus_Success ) {}
+
+	bool	await_ready( void ) { return false; }
+
+	bool	await_suspend( std::coroutine_handle<> handle )
+	{
+		node.handle	= handle;
+
+		status_t	started	= start( [ this ]( status_t status ){
+			result	= status;
+			Scheduler::resume_later( node );
+		} );
+
+		if ( kStatus_Success != started )
+		{
+			result	= started;
+			return false;
+		}
+
+		return true;
+	}
+
+	status_t	await_resume( void ) { return result; }
+
+private:
+	F					start;
+	volatile status_t	result;
+	Scheduler::Ready	node;
+};
+
+/** Make AsyncOp awaitable
+ *
+ * @param start function to start the operation with a callback
+ * @return awaitable
+ */
+template<typename F>
+AsyncOp<F> async_op( F start )
+{
+	return AsyncOp<F>( start );
+}
+
+/** Awaitable I2C transfer
+ *	co_await gives status_t of the transfer. Buffer needs to be kept available until the transfer completes
+ *
+ * @param i2c I2C instance
+ * @param targ target address
+ * @param dir I2C::WRITE or I2C::READ
+ * @param dp data buffer
+ * @param length data length
+ * @param stop (option) generate STOP condition: "false" to make repeated-start in next transaction
+ * @return awaitable
+ */
+inline auto co_transfer( I2C& i2c, uint8_t targ, I2C::DIRECTION dir, uint8_t *dp, int length, bool stop = I2C::STOP )
+{
+	return async_op( [ &i2c, targ, dir, dp, length, stop ]( I2C::xfer_cb_t cb ){ return i2c.transfer_async( targ, dir, dp, length, cb, stop ); } );
+}
+
+/** Awaitable I2C register write
+ *
+ * @param i2c I2C instance
+ * @param targ target address
+ * @param reg register address
+ * @param dp data to write
+ * @param length data length
+ * @return awaitable
+ */
+inline auto co_reg_write( I2C& i2c, uint8_t targ, uint8_t reg, const uint8_t *dp, int length )
+{
+	return async_op( [ &i2c, targ, reg, dp, length ]( I2C::xfer_cb_t cb ){ return i2c.reg_write_async( targ, reg, dp, length, cb ); } );
+}
+
+/** Awaitable I2C register read
+ *
+ * @param i2c I2C instance
+ * @param targ target address
+ * @param reg register address
+ * @param dp data buffer for read
+ * @param length data length
+ * @return awaitable
+ */
+inline auto co_reg_read( I2C& i2c, uint8_t targ, uint8_t reg, uint8_t *dp, int length )
+{
+	return async_op( [ &i2c, targ, reg, dp, length ]( I2C::xfer_cb_t cb ){ return i2c.reg_read_async( targ, reg, dp, length, cb ); } );
+}
+
+/** Awaitable SPI transfer
+ *	co_await gives status_t of the transfer. Buffers need to be kept available until the transfer completes
+ *
+ * @param spi SPI instance
+ * @param wp data to write
+ * @param rp data buffer for read. nullptr if the read data is not needed
+ * @param length transfer length
+ * @return awaitable
+ */
+inline auto co_transfer( SPI& spi, const uint8_t *wp, uint8_t *rp, int length )
+{
+	return async_op( [ &spi, wp, rp, length ]( SPI::xfer_cb_t cb ){ return spi.transfer_async( wp, rp, length, cb ); } );
+}
+
+/** Base of Task promise. For internal use */
+struct TaskPromiseBase
+{
+	std::coroutine_handle<>	continuation;
+	bool					detached	= false;
+
+	std::suspend_always	initial_suspend( void ) noexcept { return {}; }
+	void				unhandled_exception( void ) { std::terminate(); }
+};
+
+template<typename T>
+struct TaskPromiseValue : TaskPromiseBase
+{
+	T		value{};
+	void	return_value( T v ) { value = std::move( v ); }
+	T		result( void ) { return std::move( value ); }
+};
+
+template<>
+struct TaskPromiseValue<void> : TaskPromiseBase
+{
+	void	return_void( void ) {}
+	void	result( void ) {}
+};
+
+/** Task class
+ *
+ *  @class Task
+ *
+ *	Coroutine type. A Task starts when it is awaited or spawned
+ *
+ *	@tparam T type of co_return value
+ */
+template<typename T = void>
+class Task
+{
+public:
+	struct promise_type : TaskPromiseValue<T>
+	{
+		Task	get_return_object( void ) { return Task( std::coroutine_handle<promise_type>::from_promise( *this ) ); }
+
+		struct final_awaiter
+		{
+			bool	await_ready( void ) noexcept { return false; }
+
+			std::coroutine_handle<>	await_suspend( std::coroutine_handle<promise_type> h ) noexcept
+			{
+				promise_type&	p	= h.promise();
+
+				if ( p.continuation )
+					return p.continuation;
+
+				if ( p.detached )
+				{
+					h.destroy();
+					Scheduler::finished();
+				}
+
+				return std::noop_coroutine();
+			}
+
+			void	await_resume( void ) noexcept {}
+		};
+
+		final_awaiter	final_suspend( void ) noexcept { return {}; }
+	};
+
+	Task( Task&& t ) : handle( std::exchange( t.handle, nullptr ) ) {}
+	Task( const Task& )	= delete;
+
+	~Task()
+	{
+		if ( handle )
+			handle.destroy();
+	}
+
+	/** Task state
+	 *
+	 * @return true if the coroutine has finished
+	 */
+	bool	done( void ) { return !handle || handle.done(); }
+
+	bool	await_ready( void ) { return done(); }
+
+	std::coroutine_handle<>	await_suspend( std::coroutine_handle<> awaiting )
+	{
+		handle.promise().continuation	= awaiting;
+		return handle;
+	}
+
+	T		await_resume( void ) { return handle.promise().result(); }
+
+	/** Give up ownership to run by Scheduler. For internal use */
+	std::coroutine_handle<promise_type>	release( void )
+	{
+		handle.promise().detached	= true;
+		return std::exchange( handle, nullptr );
+	}
+
+private:
+	explicit Task( std::coroutine_handle<promise_type> h ) : handle( h ) {}
+
+	std::coroutine_handle<promise_type>	handle;
+};
+
+#endif // R01LIB_COROUTINE_H
@@ -0,0 +1,230 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+#include	<memory>
+
+#include	"EventQueue.h"
+#include	"mcu.h"
+
+EventQueue::EventQueue( int depth )
+{
+	uint32_t	size	= 2;
+
+	while ( size < (uint32_t)depth )
+		size	<<= 1;
+
+	mask	= size - 1;
+
+	for ( auto& q : queues )
+	{
+		q.cells		= new event[ size ];
+		q.head		= 0;
+		q.tail		= 0;
+		q.budget	= 0;
+		q.dropped	= 0;
+		q.stats		= {};
+
+		for ( uint32_t i = 0; i < size; i++ )
+			q.cells[ i ].sequence.store( i, std::memory_order_relaxed );
+	}
+}
+
+EventQueue::~EventQueue()
+{
+	for ( auto& q : queues )
+		delete[] q.cells;
+}
+
+bool EventQueue::post( event_fp_t func, void *context, uint32_t arg, int priority )
+{
+	struct queue&	q	= queues[ (priority < High) ? High : ((Low < priority) ? Low : priority) ];
+	event			*cell;
+	uint32_t		pos;
+
+#ifdef	CPU_MCXC444VLH
+	uint32_t		primask	= DisableGlobalIRQ();
+
+	pos		= q.head.load( std::memory_order_relaxed );
+	cell	= &q.cells[ pos & mask ];
+
+	if ( cell->sequence.load( std::memory_order_acquire ) != pos )
+	{
+		q.dropped.store( q.dropped.load( std::memory_order_relaxed ) + 1, std::memory_order_relaxed );
+		EnableGlobalIRQ( primask );
+
+		return false;
+	}
+
+	q.head.store( pos + 1, std::memory_order_relaxed );
+	EnableGlobalIRQ( primask );
+#else
+	pos		= q.head.load( std::memory_order_relaxed );
+
+	//	claim a cell. the cell is free when its sequence equals to the position
+	while ( true )
+	{
+		cell	= &q.cells[ pos & mask ];
+
+		int32_t	diff	= (int32_t)(cell->sequence.load( std::memory_order_acquire ) - pos);
+
+		if ( !diff )
+		{
+			if ( q.head.compare_exchange_weak( pos, pos + 1, std::memory_order_relaxed ) )
+				break;
+		}
+		else if ( diff < 0 )
+		{
+			q.dropped.fetch_add( 1, std::memory_order_relaxed );
+
+			return false;
+		}
+		else
+		{
+			pos	= q.head.load( std::memory_order_relaxed );
+		}
+	}
+#endif
+
+	cell->body.func		= func;
+	cell->body.context	= context;
+	cell->body.arg		= arg;
+	cell->body.posted	= us_count();
+
+	//	publish to dispatch()
+	cell->sequence.store( pos + 1, std::memory_order_release );
+
+	return true;
+}
+
+bool EventQueue::post( void (*func)( void ), int priority )
+{
+	return post( call_plain, (void *)func, 0, priority );
+}
+
+bool EventQueue::take( struct queue& q, item& it )
+{
+	event	*cell	= &q.cells[ q.tail & mask ];
+
+	if ( cell->sequence.load( std::memory_order_acquire ) != q.tail + 1 )
+		return false;
+
+	it	= cell->body;
+
+	cell->sequence.store( q.tail + mask + 1, std::memory_order_release );
+	q.tail++;
+
+	return true;
+}
+
+int EventQueue::dispatch( uint32_t budget_us )
+{
+	uint32_t	start	= us_count();
+	int			count	= 0;
+	item		it;
+
+	while ( true )
+	{
+		int	p;
+
+		for ( p = High; p < PRIORITIES; p++ )
+			if ( take( queues[ p ], it ) )
+				break;
+
+		if ( PRIORITIES == p )
+			break;
+
+		struct queue&	q		= queues[ p ];
+		uint32_t		begin	= us_count();
+		uint32_t		latency	= begin - it.posted;
+
+		q.stats.dispatched++;
+		q.stats.max_latency_us	= (q.stats.max_latency_us < latency) ? latency : q.stats.max_latency_us;
+
+		if ( q.budget && (q.budget < latency) )
+			q.stats.over_budget++;
+
+		it.func( it.context, it.arg );
+
+		uint32_t		run		= us_count() - begin;
+
+		q.stats.max_run_us	= (q.stats.max_run_us < run) ? run : q.stats.max_run_us;
+		count++;
+
+		if ( budget_us && (budget_us <= us_count() - start) )
+			break;
+	}
+
+	return count;
+}
+
+int EventQueue::pending( void )
+{
+	int	n	= 0;
+
+	for ( auto& q : queues )
+		n	+= (int)(q.head.load( std::memory_order_relaxed ) - q.tail);
+
+	return n;
+}
+
+void EventQueue::latency_budget( int priority, uint32_t us )
+{
+	queues[ priority ].budget	= us;
+}
+
+const EventQueue::stats& EventQueue::statistics( int priority )
+{
+	struct queue&	q	= queues[ priority ];
+
+	q.stats.dropped	= q.dropped.load( std::memory_order_relaxed );
+
+	return q.stats;
+}
+
+void EventQueue::clear_statistics( void )
+{
+	for ( auto& q : queues )
+	{
+		q.stats		= {};
+		q.dropped	= 0;
+	}
+}
+
+EventQueue& EventQueue::shared( void )
+{
+	static EventQueue	queue;
+
+	return queue;
+}
+
+void EventQueue::call_plain( void *context, uint32_t )
+{
+	((void (*)( void ))context)();
+}
+
+static void call_function( void *context, uint32_t )
+{
+	(*(std::function<void( void )> *)context)();
+}
+
+static void call_status_function( void *context, uint32_t arg )
+{
+	(*(std::function<void( status_t )> *)context)( (status_t)arg );
+}
+
+std::function<void( void )> irq_safe( std::function<void( void )> func, EventQueue& queue, int priority )
+{
+	auto	holder	= std::make_shared<std::function<void( void )>>( func );
+
+	return [ &queue, holder, priority ]( void ){ queue.post( call_function, holder.get(), 0, priority ); };
+}
+
+std::function<void( status_t )> irq_safe( std::function<void( status_t )> func, EventQueue& queue, int priority )
+{
+	auto	holder	= std::make_shared<std::function<void( status_t )>>( func );
+
+	return [ &queue, holder, priority ]( status_t status ){ queue.post( call_status_function, holder.get(), (uint32_t)status, priority ); };
+}
@@ -0,0 +1,211 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+#ifndef R01LIB_EVENT_QUEUE_H
+#define R01LIB_EVENT_QUEUE_H
+
+extern "C" {
+#include	"fsl_common.h"
+}
+
+#include	<stdint.h>
+#include	<atomic>
+#include	<functional>
+
+/** EventQueue class
+ *
+ *  @class EventQueue
+ *
+ *	Deferred-work queue to move work out of interrupt context.
+ *	Interrupt handlers post events and the main loop runs them by dispatch().
+ *
+ *	post() is lock-free and can be called from any interrupt level and from main.
+ *	Multiple producers are supported, only one context may call dispatch().
+ *	On Cortex-M0+ (MCXC444) which has no exclusive access instructions, post() is done in a short critical section.
+ *
+ *	Each priority level has its own queue. Higher priority events are dispatched first.
+ *	Latency from post to start of the event is measured and checked against a budget per priority.
+ *	Times are taken by us_count() in micro-seconds, so those are available on all targets including MCXC444 and 
+ *	include time in sleep.
+ *
+ *	Callbacks of r01lib can be deferred by irq_safe() wrappers.
+ *
+ *	Example:
+ *	@code
+ *	void on_button( void )	//	called in main loop, not in interrupt
+ *	{
+ *		printf( "pressed\r\n" );
+ *	}
+ *
+ *	InterruptIn	button( SW2 );
+ *	button.fall( irq_safe<on_button> );
+ *
+ *	Ticker		t;
+ *	t.attach( irq_safe( [](){ sensor.read(); } ), 0.1 );
+ *
+ *	while ( true )
+ *		EventQueue::shared().dispatch();
+ *	@endcode
+ */
+class EventQueue
+{
+public:
+	using	event_fp_t	= void (*)( void *context, uint32_t arg );
+
+	/** Priority of events */
+	enum priority_t {
+		High	= 0,
+		Normal,
+		Low,
+		PRIORITIES,
+	};
+
+	/** Statistics per priority */
+	struct stats
+	{
+		uint32_t	dispatched;		/**< number of events dispatched */
+		uint32_t	dropped;		/**< number of events dropped as the queue was full */
+		uint32_t	over_budget;	/**< number of events started later than latency budget */
+		uint32_t	max_latency_us;	/**< maximum latency from post to start */
+		uint32_t	max_run_us;		/**< maximum execution time of an event */
+	};
+
+	/** Create an EventQueue instance
+	 *
+	 * @param depth (option) number of events can be queued for each priority. Rounded up to power of 2
+	 */
+	EventQueue( int depth = 32 );
+	virtual ~EventQueue();
+
+	EventQueue( const EventQueue& )				= delete;
+	EventQueue& operator=( const EventQueue& )	= delete;
+
+	/** Post an event. Can be called in interrupt context
+	 *
+	 * @param func function to be called in dispatch()
+	 * @param context (option) pointer given to the function
+	 * @param arg (option) value given to the function
+	 * @param priority (option) priority
+	 * @return true if posted, false if the queue was full
+	 */
+	bool		post( event_fp_t func, void *context = nullptr, uint32_t arg = 0, int priority = Normal );
+
+	/** Post a plain function. Can be called in interrupt context
+	 *
+	 * @param func function to be called in dispatch()
+	 * @param priority (option) priority
+	 * @return true if posted, false if the queue was full
+	 */
+	bool		post( void (*func)( void ), int priority = Normal );
+
+	/** Run queued events
+	 *
+	 *	Events are run in priority order. Events posted while dispatching are also run.
+	 *
+	 * @param budget_us (option) time budget. No new event is started after this time. 0 to run until empty
+	 * @return number of events run
+	 */
+	int			dispatch( uint32_t budget_us = 0 );
+
+	/** Number of queued events
+	 *
+	 * @return number of events
+	 */
+	int			pending( void );
+
+	/** Set latency budget
+	 *
+	 *	Events which are started later than this after post are counted in stats::over_budget
+	 *
+	 * @param priority priority
+	 * @param us latency budget in micro-seconds. 0 for no check
+	 */
+	void		latency_budget( int priority, uint32_t us );
+
+	/** Statistics
+	 *
+	 * @param priority priority
+	 * @return statistics
+	 */
+	const stats&	statistics( int priority );
+
+	/** Clear statistics */
+	void		clear_statistics( void );
+
+	/** Queue used by irq_safe() wrappers by default
+	 *
+	 *	It is created at first call. Call this in main before enabling interrupts which post to it
+	 *
+	 * @return queue
+	 */
+	static EventQueue&	shared( void );
+
+private:
+	struct item
+	{
+		event_fp_t				func;
+		void					*context;
+		uint32_t				arg;
+		uint32_t				posted;		//	us_count() at post
+	};
+
+	struct event
+	{
+		std::atomic<uint32_t>	sequence;
+		item					body;
+	};
+
+	struct queue
+	{
+		event					*cells;
+		std::atomic<uint32_t>	head;
+		uint32_t				tail;
+		uint32_t				budget;
+		std::atomic<uint32_t>	dropped;
+		struct stats			stats;
+	};
+
+	bool		take( struct queue& q, item& it );
+	static void	call_plain( void *context, uint32_t arg );
+
+	queue		queues[ PRIORITIES ];
+	uint32_t	mask;
+};
+
+/** Wrapper to defer a plain callback (InterruptIn, Serial, I3C IBI) into EventQueue::shared()
+ *
+ *	@code
+ *	button.fall( irq_safe<on_button> );
+ *	@endcode
+ */
+template<void (*FUNC)( void ), int PRIORITY = EventQueue::Normal>
+void irq_safe( void )
+{
+	EventQueue::shared().post( FUNC, PRIORITY );
+}
+
+/** Wrapper to defer a std::function callback (Ticker, AFE DRDY)
+ *
+ *	The returned function posts the callback into the queue. The callback is kept by the returned function,
+ *	so the returned function should live while events are queued
+ *
+ * @param func callback to be called in dispatch()
+ * @param queue (option) queue to post
+ * @param priority (option) priority
+ * @return function to be given as the callback
+ */
+std::function<void( void )>			irq_safe( std::function<void( void )> func, EventQueue& queue = EventQueue::shared(), int priority = EventQueue::Normal );
+
+/** Wrapper to defer a transfer completion callback (SPI::transfer_async)
+ *
+ * @param func callback to be called in dispatch() with the status
+ * @param queue (option) queue to post
+ * @param priority (option) priority
+ * @return function to be given as the callback
+ */
+std::function<void( status_t )>		irq_safe( std::function<void( status_t )> func, EventQueue& queue = EventQueue::shared(), int priority = EventQueue::Normal );
+
+#endif // R01LIB_EVENT_QUEUE_H
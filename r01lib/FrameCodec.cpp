@@ -0,0 +1,146 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+#include	"FrameCodec.h"
+
+uint16_t FrameCodec::crc16( const uint8_t *data, size_t length, uint16_t crc )
+{
+	for ( size_t i = 0; i < length; i++ )
+	{
+		crc	^= (uint16_t)data[ i ] << 8;
+
+		for ( int bit = 0; bit < 8; bit++ )
+			crc	= (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+	}
+
+	return crc;
+}
+
+size_t FrameCodec::encode( const uint8_t *data, size_t length, uint8_t *dst )
+{
+	if ( MAX_PAYLOAD < length )
+		return 0;
+
+	uint16_t	crc			= crc16( data, length );
+	uint8_t		tail[ 2 ]	= { (uint8_t)(crc >> 8), (uint8_t)crc };
+	uint8_t		*code_p		= dst;
+	uint8_t		code		= 1;
+	uint8_t		*wp			= dst + 1;
+
+	for ( size_t i = 0; i < length + 2; i++ )
+	{
+		uint8_t	b	= (i < length) ? data[ i ] : tail[ i - length ];
+
+		if ( b )
+		{
+			*wp++	= b;
+			code++;
+		}
+
+		if ( !b || (0xFF == code) )
+		{
+			*code_p	= code;
+			code_p	= wp++;
+			code	= 1;
+		}
+	}
+
+	*code_p	= code;
+	*wp++	= 0x00;
+
+	return wp - dst;
+}
+
+FrameCodec::Decoder::Decoder() : frames( 0 ), crc_errors( 0 ), format_errors( 0 ), frame_length( 0 )
+{
+	reset();
+}
+
+void FrameCodec::Decoder::reset( void )
+{
+	count		= 0;
+	code		= 0xFF;
+	remaining	= 0;
+	discard		= false;
+	empty		= true;
+}
+
+bool FrameCodec::Decoder::feed( uint8_t byte )
+{
+	if ( !byte )
+	{
+		bool	done	= false;
+
+		if ( !discard && !empty )
+		{
+			if ( remaining || (count < 2) )
+			{
+				format_errors++;
+			}
+			else if ( crc16( buffer, count - 2 ) != (((uint16_t)buffer[ count - 2 ] << 8) | buffer[ count - 1 ]) )
+			{
+				crc_errors++;
+			}
+			else
+			{
+				frame_length	= count - 2;
+				frames++;
+				done	= true;
+			}
+		}
+
+		reset();
+
+		return done;
+	}
+
+	if ( discard )
+		return false;
+
+	empty	= false;
+
+	if ( !remaining )
+	{
+		//	a group ended by 0x00 unless it was a full (0xFF) group
+		if ( (0xFF != code) && !append( 0x00 ) )
+			return false;
+
+		code		= byte;
+		remaining	= byte - 1;
+	}
+	else
+	{
+		append( byte );
+		remaining--;
+	}
+
+	return false;
+}
+
+bool FrameCodec::Decoder::append( uint8_t byte )
+{
+	if ( sizeof( buffer ) <= count )
+	{
+		format_errors++;
+		discard	= true;
+
+		return false;
+	}
+
+	buffer[ count++ ]	= byte;
+
+	return true;
+}
+
+const uint8_t* FrameCodec::Decoder::data( void ) const
+{
+	return buffer;
+}
+
+size_t FrameCodec::Decoder::length( void ) const
+{
+	return frame_length;
+}
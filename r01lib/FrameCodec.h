@@ -0,0 +1,117 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/** Frame encoding for binary records on byte streams
+ *
+ *	A frame is COBS encoded (payload + CRC-16) followed by 0x00 delimiter. 
+ *	CRC is CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF) of payload, appended in big-endian. 
+ *	After COBS encoding, 0x00 appears only as the delimiter so a receiver can re-synchronize at any 0x00. 
+ *
+ *	This file has no dependency on MCU SDK. It can be built on PC for host-side tools to decode the frames. 
+ */
+
+#ifndef R01LIB_FRAME_CODEC_H
+#define R01LIB_FRAME_CODEC_H
+
+#include	<stdint.h>
+#include	<stddef.h>
+
+/** FrameCodec class
+ *
+ *  @class FrameCodec
+ *
+ *	COBS + CRC-16 frame encoder and incremental decoder
+ */
+class FrameCodec
+{
+public:
+	/** Maximum payload length in bytes. Encoded frame fits in 255 bytes */
+	static constexpr size_t	MAX_PAYLOAD	= 240;
+
+	/** Maximum length of encoded frame for payload length
+	 *
+	 * @param length payload length
+	 * @return encoded length including delimiter
+	 */
+	static constexpr size_t	encoded_size( size_t length )
+	{
+		return (length + 2) + ((length + 2) / 254 + 1) + 1;
+	}
+
+	/** CRC-16/CCITT-FALSE
+	 *
+	 * @param data data
+	 * @param length data length
+	 * @param crc (option) initial value, or CRC of previous data to continue
+	 * @return CRC value
+	 */
+	static uint16_t	crc16( const uint8_t *data, size_t length, uint16_t crc = 0xFFFF );
+
+	/** Encode a frame
+	 *
+	 * @param data payload
+	 * @param length payload length (up to MAX_PAYLOAD)
+	 * @param dst buffer for the frame. It needs encoded_size( length ) bytes
+	 * @return frame length including delimiter, 0 if length is too long
+	 */
+	static size_t	encode( const uint8_t *data, size_t length, uint8_t *dst );
+
+	/** Decoder class
+	 *
+	 *  @class Decoder
+	 *
+	 *	Incremental decoder. Give received bytes one by one by feed()
+	 */
+	class Decoder
+	{
+	public:
+		Decoder();
+
+		/** Decode a received byte
+		 *
+		 * @param byte received byte
+		 * @return true when a frame with valid CRC is completed. The payload is available by data() and length()
+		 */
+		bool			feed( uint8_t byte );
+
+		/** Clear decoding state. Bytes until next delimiter are discarded */
+		void			reset( void );
+
+		/** Payload of last completed frame
+		 *
+		 * @return pointer to payload
+		 */
+		const uint8_t*	data( void ) const;
+
+		/** Payload length of last completed frame
+		 *
+		 * @return payload length
+		 */
+		size_t			length( void ) const;
+
+		/** Number of frames with valid CRC */
+		uint32_t		frames;
+
+		/** Number of frames discarded by CRC mismatch */
+		uint32_t		crc_errors;
+
+		/** Number of frames discarded by broken encoding or length over MAX_PAYLOAD */
+		uint32_t		format_errors;
+
+	private:
+		size_t			frame_length;
+		bool			append( uint8_t byte );
+
+		uint8_t			buffer[ MAX_PAYLOAD + 2 ];
+		size_t			count;
+		uint8_t			code;
+		uint8_t			remaining;
+		bool			discard;
+		bool			empty;
+	};
+};
+
+#endif // R01LIB_FRAME_CODEC_H
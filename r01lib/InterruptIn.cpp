@@ -40,14 +40,40 @@ extern "C" {
 #if (defined(FSL_FEATURE_PORT_HAS_NO_INTERRUPT) && FSL_FEATURE_PORT_HAS_NO_INTERRUPT)
 #define	kRisingEdge		kGPIO_InterruptRisingEdge
 #define	kFallingEdge	kGPIO_InterruptFallingEdge
+#define	kEitherEdge		kGPIO_InterruptEitherEdge
+#define	kNoEdge			kGPIO_InterruptStatusFlagDisabled
 #else
 #define	kRisingEdge		kPORT_InterruptRisingEdge
 #define	kFallingEdge	kPORT_InterruptFallingEdge
-typedef void (*utick_callback_t)(void);
+#define	kEitherEdge		kPORT_InterruptEitherEdge
+#define	kNoEdge			kPORT_InterruptOrDMADisabled
 #endif
 
+typedef struct	_cb_entry {
+	ctx_func_ptr	func;
+	void			*context;
+} cb_entry_t;
 
-utick_callback_t	cb_table[ N_GPIO ][ GPIO_BITS ]	= { NULL };
+cb_entry_t	cb_table[ N_GPIO ][ GPIO_BITS ]	= {};
+
+static void call_plain( void *context )
+{
+	((func_ptr)context)();
+}
+
+/*	callbacks are called for set bits only, lowest pin first	*/
+static inline void dispatch( cb_entry_t *table, uint32_t flags )
+{
+	while ( flags )
+	{
+		cb_entry_t	*e	= &table[ __builtin_ctz( flags ) ];
+
+		flags	&= flags - 1;
+
+		if ( e->func )
+			e->func( e->context );
+	}
+}
 
 #if (defined(FSL_FEATURE_PORT_HAS_NO_INTERRUPT) && FSL_FEATURE_PORT_HAS_NO_INTERRUPT)
 
@@ -56,10 +82,8 @@ void irq_handler( int num )
 	uint32_t	flags;
 	flags	= GPIO_GpioGetInterruptFlags( gpio_ptr[ num ] );
 	GPIO_GpioClearInterruptFlags( gpio_ptr[ num ], flags );
-	
-	for ( int i = 0; i < GPIO_BITS; i++ )
-		if ( cb_table[ num ][ i ] && (flags & (1 << i)) )
-			(cb_table[ num ][ i ])();
+
+	dispatch( cb_table[ num ], flags );
 	
 	SDK_ISR_EXIT_BARRIER;
 }
@@ -71,16 +95,14 @@ void irq_handler( int num )
 	PORT_Type	*ports[]	= { PORTA, PORTC, PORTD };
 	GPIO_Type	*gpios[]	= { GPIOA, GPIOC, GPIOD };
 	uint32_t	flags;
+	int			last		= num ? 2 : 0;	//	PORTA or PORTC_PORTD vector
 	
-	for ( int i = num; i < 3; i++ )
+	for ( int i = num; i <= last; i++ )
 	{
 		if ( (flags	= ports[ i ]->ISFR) )
 		{
 			GPIO_PortClearInterruptFlags( gpios[ i ], flags );
-
-			for ( int b = 0; b < GPIO_BITS; b++ )
-				if ( cb_table[ i ][ b ] && flags & (1 << b) )
-					(cb_table[ i ][ b ])();			
+			dispatch( cb_table[ i ], flags & ((1UL << GPIO_BITS) - 1) );
 		}
 	}
 	SDK_ISR_EXIT_BARRIER;
@@ -92,25 +114,46 @@ void irq_handler( int num )
 
 InterruptIn::InterruptIn( uint8_t pin_num )
 	: DigitalIn( pin_num )
+#ifndef	CPU_MCXC444VLH
+	, capture_head( 0 ), capture_tail( 0 ), capture_overrun( 0 ),
+	capturing( false ), capture_level( false ), last_rise( 0 ), last_fall( 0 ), period_us( 0 ), high_us( 0 ), rises( 0 ), freq_rises( 0 ), freq_time( 0 )
+#endif
 {
 }
 
-InterruptIn::~InterruptIn() {}
+InterruptIn::~InterruptIn()
+{
+#ifndef	CPU_MCXC444VLH
+	//	the capture handler must not be called with this instance after it is gone. other callbacks do not refer it
+	if ( capturing )
+		capture_stop();
+#endif
+}
 
 void InterruptIn::rise( func_ptr callback )
 {
-	regist( callback, kRisingEdge );
+	regist( callback ? call_plain : nullptr, (void *)callback, kRisingEdge );
 }
 
 void InterruptIn::fall( func_ptr callback )
 {
-	regist( *callback, kFallingEdge );
+	regist( callback ? call_plain : nullptr, (void *)callback, kFallingEdge );
+}
+
+void InterruptIn::rise( ctx_func_ptr callback, void *context )
+{
+	regist( callback, context, kRisingEdge );
+}
+
+void InterruptIn::fall( ctx_func_ptr callback, void *context )
+{
+	regist( callback, context, kFallingEdge );
 }
 
 #if (defined(FSL_FEATURE_PORT_HAS_NO_INTERRUPT) && FSL_FEATURE_PORT_HAS_NO_INTERRUPT)
-void InterruptIn::regist( func_ptr callback, gpio_interrupt_config_t type )
+void InterruptIn::regist( ctx_func_ptr callback, void *context, gpio_interrupt_config_t type )
 #else
-void InterruptIn::regist( func_ptr callback, port_interrupt_t type )
+void InterruptIn::regist( ctx_func_ptr callback, void *context, port_interrupt_t type )
 #endif
 {
 #if (defined(FSL_FEATURE_PORT_HAS_NO_INTERRUPT) && FSL_FEATURE_PORT_HAS_NO_INTERRUPT)
@@ -120,7 +163,8 @@ void InterruptIn::regist( func_ptr callback, port_interrupt_t type )
 	{
 		if ( gpio_ptr[i] == gpio_n )
 		{
-			cb_table[ i ][ gpio_pin ]	= callback;
+			DisableIRQ( irqs[ i ] );
+			cb_table[ i ][ gpio_pin ]	= { callback, context };
 			EnableIRQ( irqs[ i ] );
 			break;
 		}
@@ -145,7 +189,8 @@ void InterruptIn::regist( func_ptr callback, port_interrupt_t type )
 	{
 		if ( gpio_ptr[i] == gpio_n )
 		{
-			cb_table[ i ][ gpio_pin ]	= callback;
+			DisableIRQ( (idx == 0) ? PORTA_IRQn : PORTC_PORTD_IRQn );
+			cb_table[ i ][ gpio_pin ]	= { callback, context };
 			EnableIRQ( (idx == 0) ? PORTA_IRQn : PORTC_PORTD_IRQn );
 			break;
 		}
@@ -153,4 +198,143 @@ void InterruptIn::regist( func_ptr callback, port_interrupt_t type )
 	
 #endif
 
+#ifndef	CPU_MCXC444VLH
+	capturing	= (capture_isr == callback);
+#endif
+}
+
+#ifndef	CPU_MCXC444VLH
+void InterruptIn::capture_start( int buffer_edges )
+{
+	capture_stop();
+
+	capture_buffer.resize( buffer_edges );
+	capture_head.store( 0, std::memory_order_relaxed );
+	capture_tail.store( 0, std::memory_order_relaxed );
+	capture_overrun	= 0;
+
+	last_rise		= 0;
+	last_fall		= 0;
+	period_us		= 0;
+	high_us			= 0;
+	rises			= 0;
+	freq_rises		= 0;
+	freq_time		= 0;
+
+	capture_level	= (gpio_n->PDIR >> gpio_pin) & 1;
+
+	regist( capture_isr, this, kEitherEdge );
+}
+
+void InterruptIn::capture_stop( void )
+{
+	regist( nullptr, nullptr, kNoEdge );
+}
+
+void InterruptIn::capture_isr( void *context )
+{
+	uint32_t	time	= us_count();
+	InterruptIn	*p		= (InterruptIn *)context;
+
+	//	polarity alternates from the previous edge. reading the pin here can be wrong for a pulse shorter than the interrupt latency
+	bool		rising	= !p->capture_level;
+
+	p->capture_level	= rising;
+
+	if ( rising )
+	{
+		//	a cycle completed: high time is from previous rise to fall in the cycle
+		if ( p->rises )
+		{
+			p->period_us	= time - p->last_rise;
+			p->high_us		= (p->last_fall - p->last_rise < p->period_us) ? p->last_fall - p->last_rise : 0;
+		}
+
+		p->last_rise	= time;
+		p->rises++;
+	}
+	else
+	{
+		p->last_fall	= time;
+	}
+
+	uint32_t	head	= p->capture_head.load( std::memory_order_relaxed );
+	uint32_t	tail	= p->capture_tail.load( std::memory_order_acquire );
+
+	if ( p->capture_buffer.size() <= head - tail )
+	{
+		p->capture_overrun	= p->capture_overrun + 1;
+		return;
+	}
+
+	p->capture_buffer[ head % p->capture_buffer.size() ]	= { time, rising };
+	p->capture_head.store( head + 1, std::memory_order_release );
+}
+
+bool InterruptIn::capture_read( edge& e )
+{
+	uint32_t	tail	= capture_tail.load( std::memory_order_relaxed );
+	uint32_t	head	= capture_head.load( std::memory_order_acquire );
+
+	if ( head == tail )
+		return false;
+
+	e	= capture_buffer[ tail % capture_buffer.size() ];
+	capture_tail.store( tail + 1, std::memory_order_release );
+
+	return true;
+}
+
+int InterruptIn::capture_available( void )
+{
+	return capture_head.load( std::memory_order_acquire ) - capture_tail.load( std::memory_order_relaxed );
+}
+
+uint32_t InterruptIn::capture_overruns( void )
+{
+	return capture_overrun;
+}
+
+float InterruptIn::period( void )
+{
+	return period_us * 1e-6f;
+}
+
+float InterruptIn::pulse_width( void )
+{
+	return high_us * 1e-6f;
+}
+
+float InterruptIn::duty( void )
+{
+	uint32_t	primask	= DisableGlobalIRQ();
+	uint32_t	p		= period_us;
+	uint32_t	h		= high_us;
+
+	EnableGlobalIRQ( primask );
+
+	return p ? (float)h / p : 0.0;
+}
+
+float InterruptIn::frequency( void )
+{
+	uint32_t	primask	= DisableGlobalIRQ();
+	uint32_t	n		= rises;
+	uint32_t	t		= last_rise;
+	uint32_t	p		= period_us;
+
+	EnableGlobalIRQ( primask );
+
+	float		f		= 0.0;
+
+	if ( freq_rises && (n != freq_rises) && (t != freq_time) )
+		f	= (n - freq_rises) * 1e6f / (t - freq_time);
+	else if ( p && ((us_count() - t) < 2 * p) )
+		f	= 1e6f / p;
+
+	freq_rises	= n;
+	freq_time	= t;
+
+	return f;
 }
+#endif // !CPU_MCXC444VLH
@@ -21,8 +21,11 @@ extern "C" {
 }
 
 #include	"io.h"
+#include	<vector>
+#include	<atomic>
 
 typedef	void (*func_ptr)( void );
+typedef	void (*ctx_func_ptr)( void *context );
 
 class InterruptIn : public DigitalIn
 {	
@@ -35,6 +38,9 @@ public:
 	InterruptIn( uint8_t pin_num );
 
 	/** Destructor for InterruptIn
+	 *
+	 *	Interrupt is disabled if capture mode is active, since the handler refers this instance.
+	 *	Callbacks registered by rise()/fall() are kept, as before.
 	 */
 	virtual ~InterruptIn();
 	
@@ -50,12 +56,120 @@ public:
 	 */
 	virtual void	fall( func_ptr callback );
 
+	/** Register callback function with context which is called by rising edge
+	 *
+	 *	One function can serve many pins by giving different context to each pin
+	 *
+	 * @param callback pointer to callback function
+	 * @param context pointer given to the callback
+	 */
+	virtual void	rise( ctx_func_ptr callback, void *context );
+
+	/** Register callback function with context which is called by falling edge
+	 *
+	 * @param callback pointer to callback function
+	 * @param context pointer given to the callback
+	 */
+	virtual void	fall( ctx_func_ptr callback, void *context );
+
+#ifndef	CPU_MCXC444VLH
+	/** A captured edge */
+	struct edge
+	{
+		uint32_t	time;		/**< us_count() at the edge [us] */
+		bool		rising;		/**< true for rising edge */
+	};
+
+	/** Start capture mode
+	 *
+	 *	Both edges are timestamped by us_count() in the interrupt handler and stored in a ring buffer.
+	 *	The timebase keeps counting while the core sleeps in WFI, so capture works with sleeping main loops.
+	 *	The ring buffer is lock-free single-producer (interrupt) / single-consumer (capture_read()).
+	 *	Callbacks registered by rise()/fall() are replaced.
+	 *	Resolution is 1 micro-second and intervals up to 2^32 micro-seconds (about 71 minutes) can be measured.
+	 *	Polarity of each edge is given by alternating from the pin level at start.
+	 *	Pulse width must be longer than the interrupt latency (a few micro-seconds, longer while other interrupts run), or the edges
+	 *	are merged into one interrupt and the polarity is inverted after that. Restart capture to re-synchronize
+	 *
+	 * @param buffer_edges (option) number of edges can be buffered
+	 */
+	void			capture_start( int buffer_edges = 32 );
+
+	/** Stop capture mode. Edges in buffer can be read after stop */
+	void			capture_stop( void );
+
+	/** Read a captured edge
+	 *
+	 * @param e edge
+	 * @return true if an edge was read, false if buffer is empty
+	 */
+	bool			capture_read( edge& e );
+
+	/** Number of edges in buffer
+	 *
+	 * @return number of edges
+	 */
+	int				capture_available( void );
+
+	/** Number of edges lost by buffer full
+	 *
+	 * @return number of edges
+	 */
+	uint32_t		capture_overruns( void );
+
+	/** Period of the last cycle (rising to rising)
+	 *
+	 * @return period in seconds, 0 if not measured yet
+	 */
+	float			period( void );
+
+	/** High time of the last cycle
+	 *
+	 * @return pulse width in seconds, 0 if not measured yet
+	 */
+	float			pulse_width( void );
+
+	/** Duty cycle of the last cycle
+	 *
+	 * @return ratio of high time to period (0.0 ~ 1.0)
+	 */
+	float			duty( void );
+
+	/** Frequency
+	 *
+	 *	Average of cycles since previous call, like a gated counter.
+	 *	If no cycle completed since previous call, the last period is used. 0 if the input stopped for 2 periods
+	 *
+	 * @return frequency in Hz
+	 */
+	float			frequency( void );
+#endif // !CPU_MCXC444VLH
+
 private:
 #if (defined(FSL_FEATURE_PORT_HAS_NO_INTERRUPT) && FSL_FEATURE_PORT_HAS_NO_INTERRUPT)
-	void	regist( func_ptr callback, gpio_interrupt_config_t type );
+	void	regist( ctx_func_ptr callback, void *context, gpio_interrupt_config_t type );
 #else
-	void	regist( func_ptr callback, port_interrupt_t type );
+	void	regist( ctx_func_ptr callback, void *context, port_interrupt_t type );
 #endif
+
+#ifndef	CPU_MCXC444VLH
+	static void				capture_isr( void *context );
+
+	std::vector<edge>		capture_buffer;
+	std::atomic<uint32_t>	capture_head;
+	std::atomic<uint32_t>	capture_tail;
+	volatile uint32_t		capture_overrun;
+
+	bool					capturing;
+	bool					capture_level;
+	uint32_t				last_rise;
+	uint32_t				last_fall;
+	uint32_t				period_us;
+	uint32_t				high_us;
+	uint32_t				rises;
+	uint32_t				freq_rises;
+	uint32_t				freq_time;
+#endif // !CPU_MCXC444VLH
 };
 
 #endif // R01LIB_INTERRUPTIN_H
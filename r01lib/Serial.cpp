@@ -7,6 +7,7 @@
  *    FRDM-MCXA156  (CPU_MCXA156VLL)   LPUART0
  *    FRDM-MCXN236  (CPU_MCXN236VDF)   LP_FLEXCOMM4 (LPUART4)
  *    FRDM-MCXN947  (CPU_MCXN947VDF)   LP_FLEXCOMM4 (LPUART4)
+ *    HOST          (CPU_HOST)         simulated LPUART0/1
  *
  *  Design note:
  *    Both TX and RX use software ring buffers driven directly by the LPUART
@@ -14,12 +15,22 @@
  *
  *    RX path:
  *      kLPUART_RxDataRegFullInterruptEnable fires ->
- *        ISR reads one byte -> pushes into _rx_buf -> calls _rx_callback.
+ *        ISR reads received bytes -> pushes into _rx_buf -> calls _rx_callback.
+ *        On targets with LPUART FIFO, RX interrupt comes at the RX watermark
+ *        (half of FIFO) or when the line goes idle, and the ISR drains the FIFO.
+ *        _rx_buf is the default array or a user-supplied buffer (rx_buffer()).
+ *        Bytes are counted in _rx_dropped when _rx_buf is full.
+ *      kLPUART_IdleLineInterruptEnable fires ->
+ *        ISR calls _idle_callback to hand off a completed frame.
  *
  *    TX path:
  *      putc/write/printf push bytes into _tx_buf and enable
  *      kLPUART_TxDataRegEmptyInterruptEnable ->
  *        ISR pops one byte -> writes to hardware.
+ *        On targets with LPUART FIFO, the ISR fills the TX FIFO and the
+ *        TX interrupt comes at the TX watermark (half of FIFO).
+ *        printf formats directly into _tx_buf. A part beyond the end of the
+ *        ring goes to the margin after the ring and is moved to its start.
  *        When _tx_buf is empty the ISR disables TX interrupt and calls
  *        _tx_callback (if attached).
  *
@@ -326,8 +337,58 @@ void     Serial::_release_reset( void ) { /* C444 has no RESET module */ }
 void     Serial::_register_instance( void )   { s_instances[ _instance ] = this; }
 void     Serial::_unregister_instance( void ) { s_instances[ _instance ] = nullptr; }
 
+
+// ===========================================================================
+//  HOST  (simulated LPUART0/1, see host/host_sim.h)
+// ===========================================================================
+#elif defined( CPU_HOST )
+
+static Serial *s_instances[ 2 ] = { nullptr, nullptr };
+
+extern "C"
+{
+    void LPUART0_IRQHandler( void ) { if ( s_instances[0] ) s_instances[0]->_irq_handler(); SDK_ISR_EXIT_BARRIER; }
+    void LPUART1_IRQHandler( void ) { if ( s_instances[1] ) s_instances[1]->_irq_handler(); SDK_ISR_EXIT_BARRIER; }
+}
+
+struct lpuart_pin_map_t {
+    int          tx_pin, rx_pin;
+    LPUART_Type *base;
+    uint32_t     instance;
+    port_mux_t   mux;
+    IRQn_Type    irqn;
+};
+
+static const lpuart_pin_map_t s_pinMap[] = {
+    //  TX       RX       base     inst  mux             irqn
+    { USBTX, USBRX, LPUART0, 0U, kPORT_MuxAlt2, LPUART0_IRQn }, // USBTX/USBRX
+    { MB_TX, MB_RX, LPUART1, 1U, kPORT_MuxAlt2, LPUART1_IRQn }, // MikroBus
+};
+
+void Serial::resolve_pins( int tx, int rx )
+{
+    _base = nullptr;
+    for ( size_t i = 0; i < sizeof(s_pinMap)/sizeof(s_pinMap[0]); i++ )
+    {
+        if ( s_pinMap[i].tx_pin == tx && s_pinMap[i].rx_pin == rx )
+        {
+            _base      = s_pinMap[i].base;
+            _instance  = s_pinMap[i].instance;
+            _mux       = s_pinMap[i].mux;
+            _irqn      = s_pinMap[i].irqn;
+            return;
+        }
+    }
+}
+
+void     Serial::_setup_clock( void )    { /* no clock setting on host */ }
+uint32_t Serial::_get_clk_freq( void )   { return CLOCK_GetLpuartClkFreq( _instance ); }
+void     Serial::_release_reset( void )  { /* no RESET module on host */ }
+void     Serial::_register_instance( void )   { s_instances[ _instance ] = this; }
+void     Serial::_unregister_instance( void ) { s_instances[ _instance ] = nullptr; }
+
 #else
-#  error "Serial.cpp: unsupported target. Define one of: CPU_MCXC444VLH, CPU_MCXA153VLH, CPU_MCXA156VLL, CPU_MCXN236VDF, CPU_MCXN947VDF."
+#  error "Serial.cpp: unsupported target. Define one of: CPU_MCXC444VLH, CPU_MCXA153VLH, CPU_MCXA156VLL, CPU_MCXN236VDF, CPU_MCXN947VDF, CPU_HOST."
 #endif  // target selection
 
 
@@ -339,10 +400,12 @@ Serial::Serial( int tx, int rx, int baud )
     : Obj( true ),
       _base( nullptr ), _config{}, _clk_freq( 0U ),
       _instance( 0U ), _mux( kPORT_MuxAlt2 ), _irqn( NotAvail_IRQn ),
-      _tx_pin( tx ), _rx_pin( rx ),
-      _rx_head( 0 ), _rx_tail( 0 ),
-      _tx_head( 0 ), _tx_tail( 0 ),
-      _rx_callback( nullptr ), _tx_callback( nullptr )
+      _tx_pin( tx ), _rx_pin( rx ), _fifo_size( 1U ),
+      _rx_buf( _rx_default_buf ), _rx_size( RX_RING_BUF_SIZE ), _rx_user_buf( false ),
+      _rx_head( 0 ), _rx_tail( 0 ), _rx_dropped( 0 ), _rx_overruns( 0 ),
+      _tx_head( 0 ), _tx_tail( 0 ), _tx_reserved( 0 ), _tx_writers( 0 ),
+      _tx_acquired( 0 ), _tx_acquired_size( 0 ), _tx_policy( Block ), _tx_dropped( 0 ),
+      _rx_callback( nullptr ), _tx_callback( nullptr ), _idle_callback( nullptr )
 {
     resolve_pins( tx, rx );
 
@@ -371,8 +434,15 @@ Serial::Serial( int tx, int rx, int baud )
     _config.enableTx     = true;
     _config.enableRx     = true;
 
+#if defined( FSL_FEATURE_LPUART_HAS_FIFO ) && FSL_FEATURE_LPUART_HAS_FIFO
+    _fifo_size              = FSL_FEATURE_LPUART_FIFO_SIZEn( _base );
+    _config.txFifoWatermark = (uint8_t)( _fifo_size / 2U );
+    _config.rxFifoWatermark = (uint8_t)( _fifo_size / 2U );
+#endif
+
     _clk_freq = _get_clk_freq();
     LPUART_Init( _base, &_config, _clk_freq );
+    fifo_setup();
 }
 
 Serial::~Serial()
@@ -382,7 +452,8 @@ Serial::~Serial()
 
     LPUART_DisableInterrupts( _base,
         kLPUART_RxDataRegFullInterruptEnable |
-        kLPUART_TxDataRegEmptyInterruptEnable );
+        kLPUART_TxDataRegEmptyInterruptEnable |
+        kLPUART_IdleLineInterruptEnable );
     DisableIRQ( _irqn );
 
     LPUART_Deinit( _base );
@@ -395,21 +466,142 @@ Serial::~Serial()
 
 void Serial::tx_enqueue( uint8_t b )
 {
-    uint16_t next;
-    do {
-        next = (uint16_t)(( _tx_head + 1U ) & ( TX_RING_BUF_SIZE - 1U ));
-    } while ( next == _tx_tail );   // spin if TX buffer full
+    uint16_t start;
 
-    _tx_buf[ _tx_head ] = b;
-    _tx_head = next;
+    while ( !tx_reserve( 1U, &start ) )
+    {
+        if ( _tx_policy != Block )
+        {
+            _tx_dropped = _tx_dropped + 1U;
+            return;
+        }
+
+        tx_wait_space( 1U );
+    }
+
+    _tx_buf[ start ] = b;
+    tx_commit( start, 1U, 1U );
+}
+
+size_t Serial::tx_space( void )
+{
+    return ( _tx_tail - _tx_reserved - 1U ) & ( TX_RING_BUF_SIZE - 1U );
+}
+
+void Serial::tx_wait_space( size_t length )
+{
+    if ( tx_space() >= length )
+        return;
 
+    // make sure the ISR is draining while waiting
     EnableIRQ( _irqn );
     LPUART_EnableInterrupts( _base, kLPUART_TxDataRegEmptyInterruptEnable );
+
+    while ( tx_space() < length )
+        ;
+}
+
+bool Serial::tx_reserve( size_t length, uint16_t *start )
+{
+    // masked, since a writer in an interrupt handler may reserve at the same time
+    uint32_t primask = DisableGlobalIRQ();
+    bool     ok      = ( tx_space() >= length );
+
+    if ( ok )
+    {
+        *start       = _tx_reserved;
+        _tx_reserved = (uint16_t)( ( _tx_reserved + length ) & ( TX_RING_BUF_SIZE - 1U ) );
+        _tx_writers  = _tx_writers + 1U;
+    }
+
+    EnableGlobalIRQ( primask );
+    return ok;
+}
+
+void Serial::tx_commit( uint16_t start, size_t reserved, size_t length )
+{
+    uint32_t primask = DisableGlobalIRQ();
+    size_t   end     = start + length;
+
+    // move the part written in the margin to the start of the ring
+    if ( end > TX_RING_BUF_SIZE )
+        memcpy( (uint8_t *)_tx_buf, (uint8_t *)_tx_buf + TX_RING_BUF_SIZE, end - TX_RING_BUF_SIZE );
+
+    // return unused area. data of writers which interrupted this one is moved down
+    if ( length < reserved )
+    {
+        uint16_t from = (uint16_t)( ( start + reserved ) & ( TX_RING_BUF_SIZE - 1U ) );
+        uint16_t to   = (uint16_t)( end & ( TX_RING_BUF_SIZE - 1U ) );
+
+        while ( from != _tx_reserved )
+        {
+            _tx_buf[ to ] = _tx_buf[ from ];
+            from          = (uint16_t)( ( from + 1U ) & ( TX_RING_BUF_SIZE - 1U ) );
+            to            = (uint16_t)( ( to + 1U ) & ( TX_RING_BUF_SIZE - 1U ) );
+        }
+
+        _tx_reserved = to;
+    }
+
+    // interrupted writers have finished before this one. publish all when this is the outermost
+    _tx_writers = _tx_writers - 1U;
+
+    if ( !_tx_writers )
+    {
+        _tx_head = _tx_reserved;
+
+        EnableIRQ( _irqn );
+        LPUART_EnableInterrupts( _base, kLPUART_TxDataRegEmptyInterruptEnable );
+    }
+
+    EnableGlobalIRQ( primask );
+}
+
+void Serial::fifo_setup( void )
+{
+#if defined( FSL_FEATURE_LPUART_HAS_FIFO ) && FSL_FEATURE_LPUART_HAS_FIFO
+    // RDRF also asserts when the line is idle for 1 character with data below RX watermark
+    _base->FIFO = ( _base->FIFO & ~LPUART_FIFO_RXIDEN_MASK ) | LPUART_FIFO_RXIDEN( 1U );
+#endif
+}
+
+uint32_t Serial::rx_hw_count( uint32_t flags )
+{
+#if defined( FSL_FEATURE_LPUART_HAS_FIFO ) && FSL_FEATURE_LPUART_HAS_FIFO
+    (void)flags;
+    return LPUART_GetRxFifoCount( _base );
+#else
+    return ( flags & kLPUART_RxDataRegFullFlag ) ? 1U : 0U;
+#endif
+}
+
+bool Serial::tx_hw_room( void )
+{
+#if defined( FSL_FEATURE_LPUART_HAS_FIFO ) && FSL_FEATURE_LPUART_HAS_FIFO
+    return LPUART_GetTxFifoCount( _base ) < _fifo_size;
+#else
+    return false;   // one byte per TX interrupt
+#endif
+}
+
+bool Serial::rx_buffered( void )
+{
+    return _rx_callback || _idle_callback || _rx_user_buf;
 }
 
 void Serial::update_irq_enables( void )
 {
-    if ( _rx_callback )
+    if ( _idle_callback )
+    {
+        LPUART_ClearStatusFlags( _base, kLPUART_IdleLineFlag );
+        LPUART_EnableInterrupts( _base, kLPUART_IdleLineInterruptEnable );
+    }
+    else
+    {
+        LPUART_DisableInterrupts( _base, kLPUART_IdleLineInterruptEnable );
+    }
+
+    if ( rx_buffered() )
     {
         EnableIRQ( _irqn );
         LPUART_EnableInterrupts( _base, kLPUART_RxDataRegFullInterruptEnable );
@@ -433,39 +625,160 @@ void Serial::attach( func_ptr callback, IrqType type )
         _rx_callback = callback;
         update_irq_enables();
     }
+    else if ( type == IdleIrq )
+    {
+        _idle_callback = callback;
+        update_irq_enables();
+    }
     else
     {
         _tx_callback = callback;
     }
 }
 
+status_t Serial::rx_buffer( uint8_t *buffer, size_t size )
+{
+    if ( buffer && ( !size || ( size & ( size - 1U ) ) ) )
+        return kStatus_InvalidArgument;
+
+    LPUART_DisableInterrupts( _base, kLPUART_RxDataRegFullInterruptEnable );
+
+    _rx_user_buf = ( buffer != nullptr );
+    _rx_buf      = buffer ? buffer : _rx_default_buf;
+    _rx_size     = buffer ? size   : RX_RING_BUF_SIZE;
+    _rx_head     = 0;
+    _rx_tail     = 0;
+
+    update_irq_enables();
+
+    return kStatus_Success;
+}
+
+size_t Serial::rx_count( void )
+{
+    return ( _rx_head - _rx_tail ) & ( _rx_size - 1U );
+}
+
+size_t Serial::receive( uint8_t *data, size_t length )
+{
+    size_t n = 0;
+
+    while ( ( n < length ) && ( _rx_head != _rx_tail ) )
+    {
+        data[ n++ ] = _rx_buf[ _rx_tail ];
+        _rx_tail    = ( _rx_tail + 1U ) & ( _rx_size - 1U );
+    }
+
+    return n;
+}
+
+uint8_t* Serial::tx_acquire( size_t length )
+{
+    if ( ( length > PRINTF_BUF_SIZE ) || ( length > TX_RING_BUF_SIZE - 1U ) )
+        return nullptr;
+
+    while ( !tx_reserve( length, &_tx_acquired ) )
+    {
+        if ( _tx_policy != Block )
+        {
+            _tx_dropped = _tx_dropped + length;
+            return nullptr;
+        }
+
+        tx_wait_space( length );
+    }
+
+    _tx_acquired_size = (uint16_t)length;
+
+    return (uint8_t *)_tx_buf + _tx_acquired;
+}
+
+void Serial::tx_release( size_t length )
+{
+    if ( length > _tx_acquired_size )
+        length = _tx_acquired_size;
+
+    tx_commit( _tx_acquired, _tx_acquired_size, length );
+}
+
+uint32_t Serial::rx_dropped( void )
+{
+    return _rx_dropped;
+}
+
+uint32_t Serial::rx_overruns( void )
+{
+    return _rx_overruns;
+}
+
+void Serial::clear_counters( void )
+{
+    _rx_dropped  = 0;
+    _rx_overruns = 0;
+    _tx_dropped  = 0;
+}
+
+void Serial::tx_policy( TxPolicy policy )
+{
+    _tx_policy = policy;
+}
+
+uint32_t Serial::tx_dropped( void )
+{
+    return _tx_dropped;
+}
+
 void Serial::_irq_handler( void )
 {
     uint32_t flags = LPUART_GetStatusFlags( _base );
 
-    // ---- RX: one byte received ----
-    if ( flags & kLPUART_RxDataRegFullFlag )
+    // ---- Overrun: count and clear flag ----
+    if ( flags & kLPUART_RxOverrunFlag )
+    {
+        _rx_overruns = _rx_overruns + 1U;
+        LPUART_ClearStatusFlags( _base, kLPUART_RxOverrunFlag );
+    }
+
+    // ---- RX: read all received bytes ----
+    for ( uint32_t n = rx_hw_count( flags ); n; n = rx_hw_count( flags ) )
     {
         uint8_t  byte = LPUART_ReadByte( _base );
-        uint16_t next = (uint16_t)(( _rx_head + 1U ) & ( RX_RING_BUF_SIZE - 1U ));
+        uint32_t next = ( _rx_head + 1U ) & ( _rx_size - 1U );
 
-        if ( next != _rx_tail )   // drop silently if ring buffer full
+        if ( next != _rx_tail )
         {
             _rx_buf[ _rx_head ] = byte;
             _rx_head = next;
         }
+        else
+        {
+            _rx_dropped = _rx_dropped + 1U;   // ring buffer full
+        }
 
         if ( _rx_callback )
             _rx_callback();
+
+        flags = LPUART_GetStatusFlags( _base );
     }
 
-    // ---- TX: register empty — send next byte from ring buffer ----
-    if ( flags & kLPUART_TxDataRegEmptyFlag )
+    // ---- Idle line: end of received frame ----
+    if ( flags & kLPUART_IdleLineFlag )
+    {
+        LPUART_ClearStatusFlags( _base, kLPUART_IdleLineFlag );
+        if ( _idle_callback )
+            _idle_callback();
+    }
+
+    // ---- TX: register empty — fill FIFO from ring buffer ----
+    if ( ( flags & kLPUART_TxDataRegEmptyFlag ) &&
+         ( LPUART_GetEnabledInterrupts( _base ) & kLPUART_TxDataRegEmptyInterruptEnable ) )
     {
         if ( _tx_head != _tx_tail )
         {
-            LPUART_WriteByte( _base, _tx_buf[ _tx_tail ] );
-            _tx_tail = (uint16_t)(( _tx_tail + 1U ) & ( TX_RING_BUF_SIZE - 1U ));
+            do {
+                LPUART_WriteByte( _base, _tx_buf[ _tx_tail ] );
+                _tx_tail = (uint16_t)(( _tx_tail + 1U ) & ( TX_RING_BUF_SIZE - 1U ));
+            } while ( ( _tx_head != _tx_tail ) && tx_hw_room() );
         }
         else
         {
@@ -475,21 +788,19 @@ void Serial::_irq_handler( void )
                 _tx_callback();
         }
     }
-
-    // ---- Overrun: clear flag ----
-    if ( flags & kLPUART_RxOverrunFlag )
-        LPUART_ClearStatusFlags( _base, kLPUART_RxOverrunFlag );
 }
 
 void Serial::baud( int baudrate )
 {
     LPUART_DisableInterrupts( _base,
         kLPUART_RxDataRegFullInterruptEnable |
-        kLPUART_TxDataRegEmptyInterruptEnable );
+        kLPUART_TxDataRegEmptyInterruptEnable |
+        kLPUART_IdleLineInterruptEnable );
 
     _config.baudRate_Bps = (uint32_t)baudrate;
     LPUART_Deinit( _base );
     LPUART_Init( _base, &_config, _clk_freq );
+    fifo_setup();
 
     update_irq_enables();
 
@@ -505,13 +816,13 @@ int Serial::putc( int c )
 
 int Serial::getc( void )
 {
-    if ( _rx_callback )
+    if ( rx_buffered() )
     {
         if ( _rx_head == _rx_tail )
             return -1;
 
         uint8_t b = _rx_buf[ _rx_tail ];
-        _rx_tail  = (uint16_t)(( _rx_tail + 1U ) & ( RX_RING_BUF_SIZE - 1U ));
+        _rx_tail  = ( _rx_tail + 1U ) & ( _rx_size - 1U );
         return (int)b;
     }
     else
@@ -524,21 +835,72 @@ int Serial::getc( void )
 
 int Serial::printf( const char *fmt, ... )
 {
-    char    buf[ 256 ];
     va_list ap;
+    va_list aq;
     va_start( ap, fmt );
-    int n = vsnprintf( buf, sizeof(buf), fmt, ap );
+    va_copy( aq, ap );
+
+    // reserve free space (and the margin beyond the ring end if it wraps), then format into it.
+    // the reserved area includes the terminating null, which is not queued
+    uint16_t start;
+    size_t   reserved;
+
+    do
+    {
+        reserved = tx_space();
+        reserved = ( reserved < PRINTF_BUF_SIZE ) ? reserved : PRINTF_BUF_SIZE;
+    }
+    while ( !tx_reserve( reserved, &start ) );
+
+    size_t limit = reserved ? reserved - 1U : 0U;
+    int    r     = reserved ? vsnprintf( (char *)_tx_buf + start, reserved, fmt, ap )
+                            : vsnprintf( nullptr, 0U, fmt, ap );
+    size_t n     = ( r < 0 ) ? 0U : (size_t)r;
+
+    // longer output could never get its area in the ring with the Block policy
+    if ( n > PRINTF_MAX_LENGTH )
+    {
+        _tx_dropped = _tx_dropped + ( n - PRINTF_MAX_LENGTH );
+        n = PRINTF_MAX_LENGTH;
+    }
+
+    if ( n > limit )
+    {
+        if ( _tx_policy == Block )
+        {
+            // give back the area and format again when space for whole output is available
+            tx_commit( start, reserved, 0U );
+
+            reserved = n + 1U;
+
+            while ( !tx_reserve( reserved, &start ) )
+                tx_wait_space( reserved );
+
+            vsnprintf( (char *)_tx_buf + start, reserved, fmt, aq );
+        }
+        else if ( _tx_policy == Truncate )
+        {
+            _tx_dropped = _tx_dropped + ( n - limit );
+            n = limit;
+        }
+        else
+        {
+            _tx_dropped = _tx_dropped + n;
+            n = 0U;
+        }
+    }
+
+    va_end( aq );
     va_end( ap );
 
-    for ( int i = 0; i < n; i++ )
-        tx_enqueue( (uint8_t)buf[ i ] );
+    tx_commit( start, reserved, n );
 
-    return n;
+    return (int)n;
 }
 
 bool Serial::readable( void )
 {
-    if ( _rx_callback )
+    if ( rx_buffered() )
         return ( _rx_head != _rx_tail );
 
     return ( LPUART_GetStatusFlags( _base ) & kLPUART_RxDataRegFullFlag ) != 0U;
@@ -546,16 +908,53 @@ bool Serial::readable( void )
 
 bool Serial::writable( void )
 {
-    uint16_t next = (uint16_t)(( _tx_head + 1U ) & ( TX_RING_BUF_SIZE - 1U ));
-    return ( next != _tx_tail );
+    return ( tx_space() != 0U );
 }
 
 status_t Serial::write( const uint8_t *data, size_t length )
 {
-    for ( size_t i = 0; i < length; i++ )
-        tx_enqueue( data[ i ] );
+    status_t status = kStatus_Success;
 
-    return kStatus_Success;
+    if ( ( _tx_policy != Block ) && ( length > tx_space() ) )
+    {
+        size_t n = ( _tx_policy == Truncate ) ? tx_space() : 0U;
+
+        _tx_dropped = _tx_dropped + ( length - n );
+        length      = n;
+        status      = kStatus_LPUART_TxBusy;
+    }
+
+    while ( length )
+    {
+        if ( _tx_policy == Block )
+            tx_wait_space( 1U );
+
+        size_t   space = tx_space();
+        size_t   n     = ( length < space ) ? length : space;
+        uint16_t start;
+
+        // copy into contiguous space, a part beyond the ring end goes to the margin
+        n = ( n < PRINTF_BUF_SIZE ) ? n : PRINTF_BUF_SIZE;
+
+        if ( !n || !tx_reserve( n, &start ) )
+        {
+            if ( _tx_policy == Block )
+                continue;
+
+            // space was taken by an interrupt handler
+            _tx_dropped = _tx_dropped + length;
+            status      = kStatus_LPUART_TxBusy;
+            break;
+        }
+
+        memcpy( (uint8_t *)_tx_buf + start, data, n );
+        tx_commit( start, n, n );
+
+        data   += n;
+        length -= n;
+    }
+
+    return status;
 }
 
 status_t Serial::read( uint8_t *data, size_t length )
@@ -0,0 +1,65 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+#include	"SerialFramer.h"
+
+static_assert( FrameCodec::encoded_size( FrameCodec::MAX_PAYLOAD ) <= SerialFramer::RX_BUFFER_SIZE, "RX buffer cannot hold a frame" );
+
+SerialFramer::SerialFramer( Serial& serial ) : _serial( serial ), _callback( nullptr ), _own_buffer( !serial.rx_buffered() )
+{
+	if ( _own_buffer )
+		_serial.rx_buffer( _rx_buffer, sizeof( _rx_buffer ) );
+}
+
+SerialFramer::~SerialFramer()
+{
+	if ( _own_buffer )
+		_serial.rx_buffer( nullptr, 0 );
+}
+
+status_t SerialFramer::send( const void *data, size_t length )
+{
+	if ( FrameCodec::MAX_PAYLOAD < length )
+		return kStatus_InvalidArgument;
+
+	size_t	size	= FrameCodec::encoded_size( length );
+	uint8_t	*wp		= _serial.tx_acquire( size );
+
+	if ( !wp )
+		return kStatus_LPUART_TxBusy;
+
+	_serial.tx_release( FrameCodec::encode( (const uint8_t *)data, length, wp ) );
+
+	return kStatus_Success;
+}
+
+void SerialFramer::attach( frame_cb_t callback )
+{
+	_callback	= callback;
+}
+
+int SerialFramer::poll( void )
+{
+	uint8_t	buf[ 32 ];
+	size_t	n;
+	int		count	= 0;
+
+	while ( (n = _serial.receive( buf, sizeof( buf ) )) )
+	{
+		for ( size_t i = 0; i < n; i++ )
+		{
+			if ( decoder.feed( buf[ i ] ) )
+			{
+				count++;
+
+				if ( _callback )
+					_callback( decoder.data(), decoder.length() );
+			}
+		}
+	}
+
+	return count;
+}
@@ -0,0 +1,91 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+#ifndef R01LIB_SERIAL_FRAMER_H
+#define R01LIB_SERIAL_FRAMER_H
+
+#include	<functional>
+
+#include	"Serial.h"
+#include	"FrameCodec.h"
+
+/** SerialFramer class
+ *
+ *  @class SerialFramer
+ *
+ *	Binary records over Serial, in COBS + CRC-16 frames (see FrameCodec.h). 
+ *	send() encodes a record directly into the TX ring buffer of Serial. 
+ *	poll() decodes received bytes from the RX ring buffer and calls the callback for each valid record. 
+ *
+ *	Example:
+ *	@code
+ *	Serial			uart( USBTX, USBRX, 921600 );
+ *	SerialFramer	framer( uart );
+ *
+ *	framer.attach( []( const uint8_t *data, size_t length ){ handle_command( data, length ); } );
+ *
+ *	while ( true )
+ *	{
+ *		telemetry_t	t	= sample();
+ *		framer.send( &t, sizeof( t ) );
+ *		framer.poll();
+ *	}
+ *	@endcode
+ */
+class SerialFramer
+{
+public:
+	using frame_cb_t	= std::function<void( const uint8_t *data, size_t length )>;
+
+	/** Size of RX buffer in this instance. Holds one frame of FrameCodec::MAX_PAYLOAD */
+	static constexpr size_t	RX_BUFFER_SIZE	= 256;
+
+	/** Create a SerialFramer instance
+	 *
+	 *	If RX ring buffer of the Serial is not enabled yet, a buffer in this instance (RX_BUFFER_SIZE bytes) is set to it. 
+	 *	Give a larger buffer by Serial::rx_buffer() if more data can be received between poll() calls
+	 *
+	 * @param serial Serial instance
+	 */
+	SerialFramer( Serial& serial );
+	virtual ~SerialFramer();
+
+	/** Send a record
+	 *
+	 *	The frame is encoded directly into TX ring buffer. TX policy of the Serial is applied when the ring is full. 
+	 *	With Serial::Drop or Serial::Truncate policy, a frame which does not fit is dropped as a whole
+	 *
+	 * @param data record data
+	 * @param length record length (up to FrameCodec::MAX_PAYLOAD)
+	 * @return status_t kStatus_Success, kStatus_InvalidArgument for too long record, kStatus_LPUART_TxBusy if dropped
+	 */
+	status_t		send( const void *data, size_t length );
+
+	/** Register callback for received records
+	 *
+	 *	The callback is called in poll()
+	 *
+	 * @param callback function to be called with record data and length
+	 */
+	void			attach( frame_cb_t callback );
+
+	/** Decode received data
+	 *
+	 * @return number of valid records received in this call
+	 */
+	int				poll( void );
+
+	/** Decoder state and counters (frames, crc_errors, format_errors) */
+	FrameCodec::Decoder		decoder;
+
+private:
+	Serial&			_serial;
+	frame_cb_t		_callback;
+	bool			_own_buffer;
+	uint8_t			_rx_buffer[ RX_BUFFER_SIZE ];
+};
+
+#endif // R01LIB_SERIAL_FRAMER_H
@@ -9,30 +9,383 @@
 extern "C" {
 #include "fsl_common.h"
 #include "fsl_debug_console.h"
+#include "fsl_ostimer.h"
 }
 
 #include	"Ticker.h"
+#include	"mcu.h"
 
-ticker_callback_fp_t	fp;
+#define	NOT_ARMED		UINT64_MAX
+#define	OSTIMER_BITS	42
 
-void _ticker_callback( void )
-{
-	if ( fp )
-		fp();
-}
+Ticker		*Ticker::wheel[ LEVELS ][ SLOTS ];
+uint64_t	Ticker::occupied[ LEVELS ];
+uint32_t	Ticker::now			= 0;
+uint32_t	Ticker::count		= 0;
+uint32_t	Ticker::tick_us		= 1000;
+uint64_t	Ticker::armed_us	= NOT_ARMED;
+uint64_t	Ticker::time_high	= 0;
+uint64_t	Ticker::time_last	= 0;
 
-//Timer::Timer( int type, uint32_t period, const std::function<void()>& callback )
 Ticker::Ticker()
-	: utick_type( UTICK0 )
+	: callback( nullptr ), period( 0 ), expires( 0 ), tick( 0 ), level( 0 ), slot( 0 ), next( nullptr ), pprev( nullptr ), stats{}
 {
-	fp	= nullptr;
 }
 
-Ticker::~Ticker() {}
+Ticker::~Ticker()
+{
+	detach();
+}
 
 void Ticker::attach( ticker_callback_fp_t callback, float sec )
 {
-	fp	= callback;
-	UTICK_SetTick( utick_type, kUTICK_Repeat, (uint32_t)(sec * 1000000.0) - 1, _ticker_callback );
+	attach_us( callback, (uint32_t)(sec * 1000000.0 + 0.5) );
+}
+
+void Ticker::attach_us( ticker_callback_fp_t callback, uint32_t period_us )
+{
+	period_us	= period_us ? period_us : 1;
+
+	start( callback, now_us() + period_us, period_us );
+}
+
+void Ticker::attach_at( ticker_callback_fp_t callback, uint64_t time_us, uint32_t period_us )
+{
+	start( callback, time_us, period_us );
+}
+
+void Ticker::attach_once( ticker_callback_fp_t callback, float sec )
+{
+	start( callback, now_us() + (uint64_t)(sec * 1000000.0 + 0.5), 0 );
+}
+
+void Ticker::detach( void )
+{
+	DisableIRQ( UTICK0_IRQn );
+
+	if ( pprev )
+	{
+		unlink();
+		count--;
+	}
+
+	EnableIRQ( UTICK0_IRQn );
+}
+
+bool Ticker::active( void )
+{
+	return nullptr != pprev;
+}
+
+uint64_t Ticker::deadline( void )
+{
+	return expires;
+}
+
+const Ticker::lateness& Ticker::lateness_stats( void )
+{
+	return stats;
+}
+
+void Ticker::clear_lateness( void )
+{
+	DisableIRQ( UTICK0_IRQn );
+	stats	= {};
+	EnableIRQ( UTICK0_IRQn );
+}
+
+void Ticker::resolution( float sec )
+{
+	if ( count )
+		return;
+
+	tick_us	= (uint32_t)(sec * 1000000.0);
+	tick_us	= tick_us ? tick_us : 1;
+}
+
+uint64_t Ticker::now_us( void )
+{
+	DisableIRQ( UTICK0_IRQn );
+
+	uint64_t	t	= time_us();
+
+	//	the timer keeps running to extend the OSTIMER counter to 64 bits
+	if ( NOT_ARMED == armed_us )
+		schedule( t );
+
+	EnableIRQ( UTICK0_IRQn );
+
+	return t;
+}
+
+void Ticker::start( ticker_callback_fp_t cb, uint64_t time, uint64_t period_us )
+{
+	DisableIRQ( UTICK0_IRQn );
+
+	uint64_t	t	= time_us();
+
+	if ( pprev )
+		unlink();
+	else if ( !count++ )
+		now	= (uint32_t)(t / tick_us);
+
+	callback	= cb;
+	period		= period_us;
+	expires		= time;
+	tick		= (uint32_t)(time / tick_us);
+	stats		= {};
+
+	link();
+
+	if ( expires < armed_us )
+		schedule( t );
+
+	EnableIRQ( UTICK0_IRQn );
+}
+
+void Ticker::link( void )
+{
+	uint32_t	delta	= tick - now;
+
+	if ( delta & 0x80000000 )	//	already past: current slot
+	{
+		tick	= now;
+		delta	= 0;
+	}
+
+	level	= 0;
+
+	while ( (level < LEVELS - 1) && ((uint32_t)SLOTS << (LEVEL_BITS * level) <= delta) )
+		level++;
+
+	//	beyond the wheel range: parked in farthest slot and re-linked when cascaded
+	uint32_t	at		= (((uint32_t)SLOTS << (LEVEL_BITS * level)) <= delta)
+							? now + (((uint32_t)SLOTS - 1) << (LEVEL_BITS * level))
+							: tick;
+
+	slot	= (at >> (LEVEL_BITS * level)) & (SLOTS - 1);
+
+	Ticker	**head	= &wheel[ level ][ slot ];
+
+	next	= *head;
+	pprev	= head;
+
+	if ( next )
+		next->pprev	= &next;
+
+	*head				 = this;
+	occupied[ level ]	|= 1ULL << slot;
+}
+
+void Ticker::unlink( void )
+{
+	*pprev	= next;
+
+	if ( next )
+		next->pprev	= pprev;
+
+	next	= nullptr;
+	pprev	= nullptr;
+
+	if ( !wheel[ level ][ slot ] )
+		occupied[ level ]	&= ~(1ULL << slot);
+}
+
+void Ticker::fire( uint64_t time )
+{
+	uint64_t	late	= time_us() - expires;
+
+	late			= (late < UINT32_MAX) ? late : UINT32_MAX;
+	stats.count++;
+	stats.last_us	= (uint32_t)late;
+	stats.max_us	= (stats.max_us < late) ? (uint32_t)late : stats.max_us;
+	stats.total_us	+= late;
+
+	if ( period )
+	{
+		uint64_t	skip	= (time - expires) / period;	//	periods already passed
+
+		stats.missed	+= (uint32_t)skip;
+		expires			+= (skip + 1) * period;
+		tick			 = (uint32_t)(expires / tick_us);
+
+		link();
+
+		if ( callback )
+			callback();
+	}
+	else
+	{
+		//	moved out as the callback may attach a new one to this instance
+		ticker_callback_fp_t	cb	= std::move( callback );
+
+		count--;
+
+		if ( cb )
+			cb();
+	}
+}
+
+void Ticker::cascade( int level )
+{
+	int		s		= (now >> (LEVEL_BITS * level)) & (SLOTS - 1);
+	Ticker	*list	= wheel[ level ][ s ];
+
+	wheel[ level ][ s ]	 = nullptr;
+	occupied[ level ]	&= ~(1ULL << s);
+
+	while ( Ticker *t = list )
+	{
+		list		= t->next;
+		t->next		= nullptr;
+		t->link();
+	}
+}
+
+void Ticker::irq_handler( void )
+{
+	uint64_t	t		= time_us();
+	uint32_t	target	= (uint32_t)(t / tick_us);
+	uint32_t	e;
+	int			lv;
+
+	armed_us	= NOT_ARMED;
+
+	while ( true )
+	{
+		//	take out the current slot into a local list. callbacks may attach/detach any timers
+		int		s		= now & (SLOTS - 1);
+		Ticker	*list	= wheel[ 0 ][ s ];
+
+		wheel[ 0 ][ s ]	 = nullptr;
+		occupied[ 0 ]	&= ~(1ULL << s);
+
+		if ( list )
+			list->pprev	= &list;
+
+		while ( Ticker *p = list )
+		{
+			p->unlink();
+
+			if ( p->expires <= t )
+				p->fire( t );
+			else
+				p->link();
+		}
+
+		if ( now == target )
+			break;
+
+		//	skip to next tick which has timers or cascading
+		if ( !next_event( &e, &lv ) || (0 < (int32_t)(e - target)) )
+		{
+			now	= target;
+			break;
+		}
+
+		now	= e;
+
+		for ( int level = 1; level < LEVELS; level++ )
+		{
+			if ( now & ((1UL << (LEVEL_BITS * level)) - 1) )
+				break;
+
+			cascade( level );
+		}
+	}
+
+	schedule( time_us() );
+}
+
+bool Ticker::next_event( uint32_t *tick, int *level )
+{
+	bool	found	= false;
+
+	for ( int lv = 0; lv < LEVELS; lv++ )
+	{
+		uint32_t	block	= now >> (LEVEL_BITS * lv);
+		int			shift	= (block + 1) & (SLOTS - 1);
+		uint64_t	occ		= occupied[ lv ];
+
+		if ( !lv )
+			occ	&= ~(1ULL << (block & (SLOTS - 1)));	//	current slot is not an event
+
+		if ( !occ )
+			continue;
+
+		//	rotate to find the nearest occupied slot after current one
+		occ	= shift ? (occ >> shift) | (occ << (SLOTS - shift)) : occ;
+
+		uint32_t	e	= (block + __builtin_ctzll( occ ) + 1) << (LEVEL_BITS * lv);
+
+		if ( !found || ((int32_t)(e - *tick) < 0) )
+		{
+			*tick	= e;
+			*level	= lv;
+			found	= true;
+		}
+	}
+
+	return found;
+}
+
+uint64_t Ticker::slot_earliest( uint32_t tick, uint64_t limit )
+{
+	for ( Ticker *p = wheel[ 0 ][ tick & (SLOTS - 1) ]; p; p = p->next )
+		limit	= (p->expires < limit) ? p->expires : limit;
+
+	return limit;
+}
+
+void Ticker::schedule( uint64_t t )
+{
+	//	limit of sleep in UTICK range. the counter is read far before it wraps (2^42 us)
+	uint64_t	max_sleep	= 0x40000000ULL;
+	uint64_t	wake		= t + max_sleep;
+
+	if ( count )
+	{
+		uint64_t	cur		= t / tick_us;
+		uint64_t	now64	= cur - (uint32_t)((uint32_t)cur - now);
+		uint32_t	e;
+		int			lv;
+
+		wake	= slot_earliest( now, wake );
+
+		if ( next_event( &e, &lv ) )
+		{
+			uint64_t	et	= (now64 + (uint32_t)(e - now)) * tick_us;
+
+			if ( et < wake )
+				wake	= lv ? et : slot_earliest( e, wake );
+		}
+	}
+
+	uint64_t	delay	= (t + 2 < wake) ? wake - t : 2;
+
+	UTICK_SetTick( UTICK0, kUTICK_Onetime, (uint32_t)(delay - 1), irq_handler );
+	armed_us	= wake;
+}
+
+uint64_t Ticker::time_us( void )
+{
+	//	OSTIMER runs at 1MHz while the core sleeps in WFI, DWT cycle counter stops in it
+	uint32_t	primask	= DisableGlobalIRQ();
+	uint64_t	t		= OSTIMER_GetCurrentTimerValue( OSTIMER0 );
+
+	if ( t < time_last )
+		time_high	+= 1ULL << OSTIMER_BITS;
+
+	time_last	= t;
+	t			+= time_high;
+
+	EnableGlobalIRQ( primask );
+
+	return t;
+}
+
+void Timeout::attach( ticker_callback_fp_t callback, float sec )
+{
+	attach_once( callback, sec );
 }
 #endif // !CPU_MCXC444VLH
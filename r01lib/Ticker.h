@@ -15,7 +15,7 @@ extern "C" {
 #include	"fsl_utick.h"
 }
 
-#include	<functional>
+#include	<stdint.h>
 
 using	ticker_callback_fp_t	= std::function<void(void)>;
 
@@ -23,23 +23,53 @@ using	ticker_callback_fp_t	= std::function<void(void)>;
  *
  *  @class Ticker
  *
- *	A class for periodic timer callbacks
+ *	A class for periodic and one-shot timer callbacks
  *
- * @note only 1 ticker can be used in this version
+ *	Any number of Ticker instances can be used.
+ *	Deadlines are absolute times in micro-seconds on a free-running 64 bit timebase (now_us()).
+ *	Periodic timers are re-armed from their ideal deadline, so the period does not drift by callback latency.
+ *
+ *	Timers are held in a hierarchical timer wheel (4 levels of 64 slots of resolution() period)
+ *	so that attach/detach are O(1) and the cost does not depend on number of timers.
+ *	The hardware timer (UTICK0) is used in one-shot mode and programmed for the next deadline only (tickless).
+ *
+ *	Callbacks are called in interrupt context.
+ *
+ *	Example:
+ *	@code
+ *	Ticker	poll_temp;
+ *	Ticker	blink;
+ *
+ *	poll_temp.attach( [](){ temp_requested = true; }, 0.5 );
+ *	blink.attach( [](){ led = !led; }, 0.1 );
+ *	@endcode
  */
 class Ticker
-{	
+{
 public:
 	enum{
 		repeat	= kUTICK_Repeat
 	};
-	
+
+	/** Lateness of callbacks from their deadlines */
+	struct lateness
+	{
+		uint32_t	count;		/**< number of callbacks */
+		uint32_t	last_us;	/**< lateness of the last callback */
+		uint32_t	max_us;		/**< maximum lateness */
+		uint64_t	total_us;	/**< sum of lateness (total_us / count for average) */
+		uint32_t	missed;		/**< periods skipped as the callback was later than a period */
+	};
+
 	/** Create a Ticker instance */
 	Ticker();
-	
-	/** Destructor to free Ticker resource */
+
+	/** Destructor to free Ticker resource. The timer is detached */
 	virtual ~Ticker();
-	
+
+	Ticker( const Ticker& )				= delete;
+	Ticker& operator=( const Ticker& )	= delete;
+
 	/** Register callback function
 	 *
 	 * @param callback callback function
@@ -47,8 +77,132 @@ public:
 	 */
 	virtual void	attach( ticker_callback_fp_t callback, float sec );
 
+	/** Register callback function with period in micro-seconds
+	 *
+	 * @param callback callback function
+	 * @param period_us periodic cycle to call the callback
+	 */
+	void			attach_us( ticker_callback_fp_t callback, uint32_t period_us );
+
+	/** Register callback function at absolute time
+	 *
+	 *	If the time is past already, the callback is called immediately
+	 *
+	 * @param callback callback function
+	 * @param time_us time of first call in now_us() timebase
+	 * @param period_us (option) periodic cycle after the first call. 0 for one-shot
+	 */
+	void			attach_at( ticker_callback_fp_t callback, uint64_t time_us, uint32_t period_us = 0 );
+
+	/** Register callback function to be called once
+	 *
+	 * @param callback callback function
+	 * @param sec delay to call the callback
+	 */
+	virtual void	attach_once( ticker_callback_fp_t callback, float sec );
+
+	/** Stop the timer */
+	virtual void	detach( void );
+
+	/** Timer state
+	 *
+	 * @return true if the callback is scheduled
+	 */
+	bool			active( void );
+
+	/** Next deadline
+	 *
+	 * @return time of next call in now_us() timebase. Not valid if the timer is not active
+	 */
+	uint64_t		deadline( void );
+
+	/** Lateness statistics
+	 *
+	 * @return statistics since attach or clear_lateness()
+	 */
+	const lateness&	lateness_stats( void );
+
+	/** Clear lateness statistics */
+	void			clear_lateness( void );
+
+	/** Set period of the timer wheel slots
+	 *
+	 *	This does not affect accuracy of deadlines. Short period reduces timers in a slot and
+	 *	long period reduces slot cascading for long timers. Default is 1ms.
+	 *	The setting is ignored while any timer is active
+	 *
+	 * @param sec slot period
+	 */
+	static void		resolution( float sec );
+
+	/** Current time of the timebase
+	 *
+	 *	Free-running 64 bit time from OSTIMER at 1MHz. It keeps counting while the core sleeps in WFI
+	 *
+	 * @return time in micro-seconds
+	 */
+	static uint64_t	now_us( void );
+
 private:
-	UTICK_Type	*utick_type;
+	static constexpr int	LEVEL_BITS	= 6;
+	static constexpr int	SLOTS		= 1 << LEVEL_BITS;
+	static constexpr int	LEVELS		= 4;
+
+	void			start( ticker_callback_fp_t callback, uint64_t time_us, uint64_t period_us );
+	void			link( void );
+	void			unlink( void );
+	void			fire( uint64_t time );
+
+	static void		irq_handler( void );
+	static void		cascade( int level );
+	static bool		next_event( uint32_t *tick, int *level );
+	static uint64_t	slot_earliest( uint32_t tick, uint64_t limit );
+	static void		schedule( uint64_t time );
+	static uint64_t	time_us( void );
+
+	ticker_callback_fp_t	callback;
+	uint64_t				period;
+	uint64_t				expires;
+	uint32_t				tick;
+	uint8_t					level;
+	uint8_t					slot;
+	Ticker					*next;
+	Ticker					**pprev;
+	struct lateness			stats;
+
+	static Ticker			*wheel[ LEVELS ][ SLOTS ];
+	static uint64_t			occupied[ LEVELS ];
+	static uint32_t			now;
+	static uint32_t			count;
+	static uint32_t			tick_us;
+	static uint64_t			armed_us;
+	static uint64_t			time_high;
+	static uint64_t			time_last;
+};
+
+/** Timeout class
+ *
+ *  @class Timeout
+ *
+ *	A Ticker which calls the callback once
+ *
+ *	Example:
+ *	@code
+ *	Timeout	led_off;
+ *
+ *	led	= 1;
+ *	led_off.attach( [](){ led = 0; }, 0.2 );
+ *	@endcode
+ */
+class Timeout : public Ticker
+{
+public:
+	/** Register callback function to be called once
+	 *
+	 * @param callback callback function
+	 * @param sec delay to call the callback
+	 */
+	virtual void	attach( ticker_callback_fp_t callback, float sec );
 };
 
 #endif // !CPU_MCXC444VLH
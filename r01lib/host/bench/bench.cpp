@@ -0,0 +1,301 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/** Benchmark of r01device drivers on host (CPU_HOST) build
+ *
+ *	Every driver class is run on simulated buses and number of bus transactions of its main APIs are reported.
+ *	I3CBus is not included because I3C is not available on host.
+ *
+ *	Usage:
+ *	@code
+ *	bench                  run and report
+ *	bench baseline.txt     run and check transactions against the baseline, exit code is number of failures
+ *	bench -w baseline.txt  run and write the baseline
+ *	@endcode
+ *
+ *	Build as "Host build" in README.md with all files in this directory as the application.
+ */
+
+#include	<string.h>
+#include	<map>
+
+#include	"r01lib.h"
+#include	"temp_sensor/TempSensor.h"
+#include	"lcd/LCDDriver.h"
+#include	"misc/lcd/I2C_Character_LCD.h"
+#include	"led/LEDDriver.h"
+#include	"led/LED.h"
+#include	"led/GradationControl.h"
+#include	"mux_sw/MUX_SW_NXP.h"
+#include	"misc/eeprom/M24C02.h"
+#include	"misc/potentiometer/AD5161.h"
+#include	"rtc/RTC_NXP.h"
+#include	"afe/NAFE13388_UIM.h"
+#include	"afe/NAFE33352_UIOM.h"
+
+#include	"bench.h"
+
+void model( uint8_t address, uint8_t ai_flag )
+{
+	static std::map<uint8_t, SimRegisterDevice *>	models;
+
+	if ( models.count( address ) )
+		return;
+
+	models[ address ]	= new SimRegisterDevice( ai_flag );
+	SimBus::attach( LPI2C0, address, models[ address ] );
+}
+
+static void bench_temp_sensor( I2C& i2c )
+{
+	model( 0x48 );
+	model( 0x49 );
+	model( 0x4A );
+	model( 0x4C );
+	model( 0x72 );
+	model( 0x70 );
+
+	LM75B		lm75b( i2c, 0x48 );
+	PCT2075		pct2075( i2c, 0x49 );
+	P3T1085		p3t1085( i2c, 0x4A );
+	P3T1755		p3t1755( i2c, 0x4C );
+	P3T1035		p3t1035( i2c, 0x72 );
+	P3T2030		p3t2030( i2c, 0x70 );
+
+	SimBench::run( "LM75B::temp()",				[&]{ lm75b.temp(); } );
+	SimBench::run( "LM75B::thresholds()",		[&]{ lm75b.thresholds( 28.0, 30.0 ); } );
+	SimBench::run( "PCT2075::temp()",			[&]{ pct2075.temp(); } );
+	SimBench::run( "P3T1085::temp()",			[&]{ p3t1085.temp(); } );
+	SimBench::run( "P3T1755::temp()",			[&]{ p3t1755.temp(); } );
+	SimBench::run( "P3T1035::temp()",			[&]{ p3t1035.temp(); } );
+	SimBench::run( "P3T2030::temp()",			[&]{ p3t2030.temp(); } );
+}
+
+static void bench_display( I2C& i2c )
+{
+	model( 0x38 );
+	model( 0x3E );
+	model( 0x3F );
+	model( 0x50 );
+
+	PCA8561		pca8561( i2c, 0x38 );
+	AQM0802		aqm0802( i2c );
+	ACM2004		acm2004( i2c );
+	ACM1602		acm1602( i2c );
+
+	pca8561.begin();
+
+	SimBench::run( "PCA8561::puts()",			[&]{ pca8561.puts( "1234" ); } );
+	SimBench::run( "AQM0802::puts()",			[&]{ aqm0802.puts( "r01lib" ); } );
+	SimBench::run( "ACM2004::puts()",			[&]{ acm2004.puts( "r01lib", 1 ); } );
+	SimBench::run( "ACM1602::puts()",			[&]{ acm1602.puts( "r01lib", 1 ); } );
+}
+
+static void bench_led( I2C& i2c, SPI& spi )
+{
+	model( 0x5E, 0x80 );
+	model( 0x60, 0x80 );
+
+	PCA9955B		pca9955b( i2c, 0x5E );
+	PCA9956B		pca9956b( i2c, 0x60 );
+	PCA9957			pca9957( spi );
+	PCA9957_Chain	chain( spi, 4 );
+	LED				led( pca9955b, 0 );
+	float			v[ 24 ]	= { 0.0 };
+
+	SimBench::run( "PCA9955B::pwm(ch)",			[&]{ pca9955b.pwm( 0, 0.5 ); } );
+	SimBench::run( "PCA9955B::pwm(all)",		[&]{ pca9955b.pwm( v ); } );
+	SimBench::run( "PCA9956B::pwm(all)",		[&]{ pca9956b.pwm( v ); } );
+	SimBench::run( "PCA9957::pwm(ch)",			[&]{ pca9957.pwm( 0, 0.5 ); } );
+	SimBench::run( "PCA9957::pwm(all)",			[&]{ pca9957.pwm( v ); } );
+	SimBench::run( "PCA9957_Chain(4)::flush()",	[&]{ chain.flush(); } );
+	SimBench::run( "LED::operator=",			[&]{ led	= 0.5; } );
+
+	SimBench::run( "GradationControl::start()",	[&]{
+		GradationControl	gc( &pca9955b, 1, 0x0007 );
+		gc.set_gradation( 1.0, 1.0 );
+		gc.start();
+	} );
+}
+
+static void bench_misc( I2C& i2c, SPI& spi )
+{
+	model( 0x71 );
+	model( 0x54 );
+	model( 0x2D );
+
+	PCA9846		pca9846( i2c, 0x71 );
+	M24C02		m24c02( i2c, 0x54 );
+	AD5161_I2C	ad5161_i2c( i2c, 0x2D );
+	AD5161_SPI	ad5161_spi( spi );
+	uint8_t		data[ 8 ]	= { 0 };
+
+	SimBench::run( "PCA9846::select()",			[&]{ pca9846.select( 0x05 ); } );
+	SimBench::run( "M24C02::write(8)",			[&]{ m24c02.write( 0, data, sizeof( data ) ); } );
+	SimBench::run( "M24C02::read(8)",			[&]{ m24c02.read( 0, data, sizeof( data ) ); } );
+	SimBench::run( "AD5161_I2C::value()",		[&]{ ad5161_i2c.value( 0x80 ); } );
+	SimBench::run( "AD5161_SPI::value()",		[&]{ ad5161_spi.value( 0x80 ); } );
+}
+
+static void bench_rtc( const char *name, RTC_NXP& rtc )
+{
+	struct tm	now{};
+
+	now.tm_year	= 126;
+	now.tm_mday	= 1;
+
+	rtc.begin();
+
+	SimBench::run( (std::string( name ) + "::time()").c_str(),		[&]{ rtc.time( nullptr ); } );
+	SimBench::run( (std::string( name ) + "::set()").c_str(),		[&]{ rtc.set( &now ); } );
+	SimBench::run( (std::string( name ) + "::alarm()").c_str(),		[&]{ rtc.alarm( RTC_NXP::MINUTE, 10 ); } );
+}
+
+static void bench_rtc( I2C& i2c, SPI& spi )
+{
+	model( 0x53 );
+	model( 0x51 );
+	model( 0x52 );
+	model( 0x55 );
+	model( 0x6F );
+
+	PCF2131		pcf2131_i2c( i2c, 0x53 );
+	PCF2131		pcf2131_spi( spi );
+	PCF85063A	pcf85063a( i2c, 0x51 );
+	PCF85063TP	pcf85063tp( i2c, 0x52 );
+	PCF85263A	pcf85263a( i2c, 0x55 );
+	PCF85053A	pcf85053a( i2c, 0x6F );
+
+	bench_rtc( "PCF2131(I2C)",	pcf2131_i2c );
+	bench_rtc( "PCF2131(SPI)",	pcf2131_spi );
+	bench_rtc( "PCF85063A",		pcf85063a );
+	bench_rtc( "PCF85063TP",	pcf85063tp );
+	bench_rtc( "PCF85263A",		pcf85263a );
+	bench_rtc( "PCF85053A",		pcf85053a );
+}
+
+static void bench_shadow( I2C& i2c )
+{
+	model( 0x53 );
+	model( 0x48 );
+
+	PCF2131	rtc( i2c, 0x53 );
+	LM75B	lm75b( i2c, 0x48 );
+
+	auto	alarm_setup	= [&]{
+		rtc.alarm( PCF2131::SECOND, 30 );
+		rtc.alarm( PCF2131::MINUTE, 10 );
+		rtc.periodic_interrupt_enable( PCF2131::EVERY_SECOND );
+		rtc.alarm_disable();
+	};
+	auto	os_mode		= [&]{
+		lm75b.os_mode( LM75B::INTERRUPT );
+		lm75b.os_mode( LM75B::COMPARATOR );
+	};
+
+	SimBench::run( "PCF2131 alarm setup",					alarm_setup );
+	SimBench::run( "LM75B::os_mode() x2",					os_mode );
+
+	rtc.shadow_enable();
+	lm75b.shadow_enable();
+
+	SimBench::run( "PCF2131 alarm setup (shadow, cold)",	alarm_setup );
+	SimBench::run( "PCF2131 alarm setup (shadow)",			alarm_setup );
+	SimBench::run( "LM75B::os_mode() x2 (shadow)",			os_mode );
+}
+
+static void bench_serial( void )
+{
+	static uint8_t	rx_buffer[ 2048 ];
+	uint8_t			data[ 1000 ];
+
+	Serial	serial( MB_TX, MB_RX, 921600 );
+
+	SimUART::sink( LPUART1, []( uint8_t ){} );	//	keep the output out of the report
+	serial.rx_buffer( rx_buffer, sizeof( rx_buffer ) );
+
+	for ( int i = 0; i < (int)sizeof( data ); i++ )
+		data[ i ]	= i * 7;
+
+	//	number of interrupts is the figure of merit. TX and RX are on FIFO watermarks
+	SimBench::run( "Serial::printf() x 20 (1280 bytes)",	[&]{
+		for ( int i = 0; i < 20; i++ )
+			serial.printf( "%063d\n", i );
+		wait_us( 20000 );
+	} );
+	SimBench::run( "Serial RX 1000 bytes",					[&]{
+		for ( int i = 0; i < (int)sizeof( data ); i++ )
+			SimUART::input( LPUART1, data + i, 1, i == (int)sizeof( data ) - 1 );
+	} );
+}
+
+static void bench_afe( SPI& spi )
+{
+	NAFE13388		nafe13388( spi );
+	NAFE13388_UIM	nafe13388_uim( spi );
+
+	SimBench::run( "NAFE13388::begin()",		[&]{ nafe13388.begin(); } );
+	SimBench::run( "NAFE13388_UIM::begin()",	[&]{ nafe13388_uim.begin(); } );
+	SimBench::run( "NAFE13388::configure()",	[&]{ nafe13388.logical_channel[ 0 ].configure( 0x1710, 0x00A4, 0xBC00, 0x0000 ); } );
+
+	//	NAFE33352 switches CS to manual control, so it is created after NAFE13388 measurements
+	NAFE33352		nafe33352( spi );
+	NAFE33352_UIOM	nafe33352_uiom( spi );
+
+	SimBench::run( "NAFE33352::begin()",		[&]{ nafe33352.begin(); } );
+	SimBench::run( "NAFE33352_UIOM::begin()",	[&]{ nafe33352_uiom.begin(); } );
+	SimBench::run( "NAFE33352::configure()",	[&]{ nafe33352.logical_channel[ 0 ].configure( 0x0010, 0x0070, 0x4C00 ); } );
+}
+
+int main( int argc, char *argv[] )
+{
+	const char	*baseline	= nullptr;
+	bool		write		= false;
+
+	for ( int i = 1; i < argc; i++ )
+	{
+		if ( !strcmp( argv[ i ], "-w" ) )
+			write		= true;
+		else
+			baseline	= argv[ i ];
+	}
+
+	if ( baseline && !write && (SimBench::load_baseline( baseline ) < 0) )
+	{
+		fprintf( stderr, "cannot open %s\n", baseline );
+		return -1;
+	}
+
+	SimSPITarget	spi_target;
+	SimBus::attach( LPSPI0, SPI_CS, &spi_target );
+
+	I2C	i2c( I2C_SDA, I2C_SCL );
+	SPI	spi( SPI_MOSI, SPI_MISO, SPI_SCLK, SPI_CS );
+
+	i2c.frequency( 400000 );
+	spi.frequency( 1000000 );
+
+	bench_temp_sensor( i2c );
+	bench_test_LM75B( i2c );
+	bench_gpio( i2c, spi );
+	bench_display( i2c );
+	bench_led( i2c, spi );
+	bench_misc( i2c, spi );
+	bench_rtc( i2c, spi );
+	bench_shadow( i2c );
+	bench_afe( spi );
+	bench_serial();
+
+	SimBench::report();
+
+	if ( baseline && write && (SimBench::save_baseline( baseline ) < 0) )
+	{
+		fprintf( stderr, "cannot write %s\n", baseline );
+		return -1;
+	}
+
+	return SimBench::failures();
+}
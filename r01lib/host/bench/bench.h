@@ -0,0 +1,36 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+#ifndef R01LIB_HOST_BENCH_H
+#define R01LIB_HOST_BENCH_H
+
+#include	"r01lib.h"
+#include	"host_sim.h"
+#include	"sim_bench.h"
+
+/** SPI target model: all bytes read as 0xFF */
+class SimSPITarget : public SimDevice
+{
+public:
+	uint8_t	spi_transfer( uint8_t ) { return 0xFF; }
+};
+
+/** Attach I2C register model at the address on LPI2C0, if not attached yet
+ *
+ * @param address target address
+ * @param ai_flag (option) auto-increment flag in register pointer
+ */
+void	model( uint8_t address, uint8_t ai_flag = 0x00 );
+
+/*
+ *	Following are in separate translation units
+ *	because GPIO_NXP.h and LEDDriver.h both define 'access_word'
+ *	and test_LM75B.h has same include guard as TempSensor.h
+ */
+void	bench_gpio( I2C& i2c, SPI& spi );
+void	bench_test_LM75B( I2C& i2c );
+
+#endif // R01LIB_HOST_BENCH_H
@@ -0,0 +1,41 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+#include	"gpio/GPIO_NXP.h"
+#include	"gpio/PORT.h"
+
+#include	"bench.h"
+
+void bench_gpio( I2C& i2c, SPI& spi )
+{
+	model( 0x20 );
+	model( 0x21 );
+	model( 0x22 );
+	model( 0x23 );
+	model( 0x24, 0x80 );
+	model( 0x25, 0x80 );
+
+	PCA9554		pca9554( i2c, 0x20 );
+	PCA9555		pca9555( i2c, 0x21 );
+	PCAL6408A	pcal6408a( i2c, 0x22 );
+	PCAL6416A	pcal6416a( i2c, 0x23 );
+	PCAL6524	pcal6524( i2c, 0x24 );
+	PCAL6534	pcal6534( i2c, 0x25 );
+	PCAL9722	pcal9722( spi );
+	GPIO_PORT	port( pca9555, 1 );
+
+	uint8_t		v[ 5 ]	= { 0 };
+
+	SimBench::run( "PCA9554::output()",			[&]{ pca9554.output( 0, 0x55 ); } );
+	SimBench::run( "PCA9555::output(mask)",		[&]{ pca9555.output( 0, 0x01, 0xFE ); } );
+	SimBench::run( "PCA9555::input()",			[&]{ pca9555.input( 0 ); } );
+	SimBench::run( "PCAL6408A::config()",		[&]{ pcal6408a.config( 0, 0x0F ); } );
+	SimBench::run( "PCAL6416A::output(all)",	[&]{ pcal6416a.output( v ); } );
+	SimBench::run( "PCAL6524::output(all)",		[&]{ pcal6524.output( v ); } );
+	SimBench::run( "PCAL6534::input()",			[&]{ pcal6534.input( 4 ); } );
+	SimBench::run( "PCAL9722::output()",		[&]{ pcal9722.output( 0, 0xAA ); } );
+	SimBench::run( "GPIO_PORT::operator=",		[&]{ port	= 0x5A; } );
+}
@@ -0,0 +1,18 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+#include	"test_LM75B.h"
+
+#include	"bench.h"
+
+void bench_test_LM75B( I2C& i2c )
+{
+	model( 0x4F );
+
+	test_LM75B	test_lm75b( i2c, 0x4F );
+
+	SimBench::run( "test_LM75B::read()",		[&]{ test_lm75b.read(); } );
+}
@@ -0,0 +1,30 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso board files
+ */
+
+#ifndef R01LIB_HOST_BOARD_H
+#define R01LIB_HOST_BOARD_H
+
+#include	"fsl_common.h"
+#include	"fsl_gpio.h"
+#include	"clock_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define	BOARD_NAME	"HOST"
+
+void	BOARD_InitDebugConsole( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // R01LIB_HOST_BOARD_H
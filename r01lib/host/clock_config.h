@@ -0,0 +1,24 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso board files
+ */
+
+#ifndef R01LIB_HOST_CLOCK_CONFIG_H
+#define R01LIB_HOST_CLOCK_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void	BOARD_InitBootClocks( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // R01LIB_HOST_CLOCK_CONFIG_H
@@ -0,0 +1,32 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso SDK "fsl_clock.h"
+ */
+
+#ifndef R01LIB_HOST_FSL_CLOCK_H
+#define R01LIB_HOST_FSL_CLOCK_H
+
+#include	"fsl_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define	HOST_CORE_CLOCK_FREQ		150000000UL
+#define	HOST_PERIPHERAL_CLOCK_FREQ	12000000UL
+
+static inline uint32_t	CLOCK_GetCoreSysClkFreq( void )				{ return HOST_CORE_CLOCK_FREQ; }
+static inline uint32_t	CLOCK_GetLpi2cClkFreq( uint32_t )	{ return HOST_PERIPHERAL_CLOCK_FREQ; }
+static inline uint32_t	CLOCK_GetLpspiClkFreq( uint32_t )	{ return HOST_PERIPHERAL_CLOCK_FREQ; }
+static inline uint32_t	CLOCK_GetLpuartClkFreq( uint32_t )	{ return HOST_PERIPHERAL_CLOCK_FREQ; }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // R01LIB_HOST_FSL_CLOCK_H
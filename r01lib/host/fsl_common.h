@@ -0,0 +1,76 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso SDK "fsl_common.h"
+ */
+
+#ifndef R01LIB_HOST_FSL_COMMON_H
+#define R01LIB_HOST_FSL_COMMON_H
+
+#include	<stdint.h>
+#include	<stdbool.h>
+#include	<stddef.h>
+#include	<string.h>
+#include	"fsl_device_registers.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*	"long" to be same as int32_t of arm-none-eabi. r01lib prints status_t with "%lX"	*/
+typedef	long	status_t;
+
+#define	MAKE_STATUS( group, code )	((((group) * 100L) + (code)))
+
+enum _status_groups
+{
+	kStatusGroup_Generic	= 0,
+	kStatusGroup_LPSPI		= 4,
+	kStatusGroup_LPI2C		= 9,
+	kStatusGroup_LPUART		= 13,
+};
+
+enum
+{
+	kStatus_Success					= MAKE_STATUS( kStatusGroup_Generic, 0 ),
+	kStatus_Fail					= MAKE_STATUS( kStatusGroup_Generic, 1 ),
+	kStatus_ReadOnly				= MAKE_STATUS( kStatusGroup_Generic, 2 ),
+	kStatus_OutOfRange				= MAKE_STATUS( kStatusGroup_Generic, 3 ),
+	kStatus_InvalidArgument			= MAKE_STATUS( kStatusGroup_Generic, 4 ),
+	kStatus_Timeout					= MAKE_STATUS( kStatusGroup_Generic, 5 ),
+	kStatus_NoTransferInProgress	= MAKE_STATUS( kStatusGroup_Generic, 6 ),
+	kStatus_Busy					= MAKE_STATUS( kStatusGroup_Generic, 7 ),
+	kStatus_NoData					= MAKE_STATUS( kStatusGroup_Generic, 8 ),
+};
+
+#define	SDK_ISR_EXIT_BARRIER
+
+/** Delay, advances simulated time on host
+ *
+ * @param delayTime_us delay time in micro-seconds
+ * @param coreClock_Hz ignored on host
+ */
+void		SDK_DelayAtLeastUs( uint32_t delayTime_us, uint32_t coreClock_Hz );
+
+status_t	EnableIRQ( IRQn_Type interrupt );
+status_t	DisableIRQ( IRQn_Type interrupt );
+uint32_t	DisableGlobalIRQ( void );
+void		EnableGlobalIRQ( uint32_t primask );
+
+void		__disable_irq( void );
+void		__enable_irq( void );
+
+/** Wait for interrupt, advances simulated time to next timer event on host */
+void		__WFI( void );
+
+static inline void	__NOP( void ) {}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // R01LIB_HOST_FSL_COMMON_H
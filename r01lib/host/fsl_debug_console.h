@@ -0,0 +1,23 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso SDK "fsl_debug_console.h"
+ *	Console output goes to stdout of the host process
+ */
+
+#ifndef R01LIB_HOST_FSL_DEBUG_CONSOLE_H
+#define R01LIB_HOST_FSL_DEBUG_CONSOLE_H
+
+#include	<stdio.h>
+#include	"fsl_common.h"
+
+#define	PRINTF	printf
+#define	SCANF	scanf
+#define	PUTCHAR	putchar
+#define	GETCHAR	getchar
+
+#endif // R01LIB_HOST_FSL_DEBUG_CONSOLE_H
@@ -0,0 +1,170 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso SDK "fsl_device_registers.h"
+ *
+ *	Peripherals are not memory mapped on host. Each "register" structure holds
+ *	the state which is needed to emulate the peripheral in host_sim.cpp.
+ */
+
+#ifndef R01LIB_HOST_FSL_DEVICE_REGISTERS_H
+#define R01LIB_HOST_FSL_DEVICE_REGISTERS_H
+
+#include	<stdint.h>
+#include	<stdbool.h>
+#include	<stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define	FSL_FEATURE_PORT_HAS_NO_INTERRUPT	1
+#define	FSL_FEATURE_LPUART_HAS_FIFO			1
+#define	FSL_FEATURE_LPUART_FIFO_SIZEn( x )	8
+#define	FSL_FEATURE_LPI2C_FIFO_SIZEn( x )	4
+#define	FSL_FEATURE_LPSPI_FIFO_SIZEn( x )	4
+
+/** interrupt numbers  */
+typedef enum IRQn
+{
+	NotAvail_IRQn			= -128,
+	GPIO0_IRQn				= 0,
+	GPIO1_IRQn,
+	GPIO2_IRQn,
+	GPIO3_IRQn,
+	LPI2C0_IRQn,
+	LPI2C1_IRQn,
+	LPSPI0_IRQn,
+	LPSPI1_IRQn,
+	LPUART0_IRQn,
+	LPUART1_IRQn,
+	UTICK0_IRQn,
+	NUMBER_OF_INT_VECTORS
+} IRQn_Type;
+
+/** GPIO  */
+typedef struct
+{
+	uint32_t	PDOR;			/**< output levels */
+	uint32_t	PDIR;			/**< input levels given by SimGPIO */
+	uint32_t	PDDR;			/**< direction, 1 = output */
+	uint32_t	ISFR;			/**< interrupt flags */
+	uint8_t		ICR[ 32 ];		/**< interrupt configuration */
+} GPIO_Type;
+
+/** PORT  */
+typedef struct
+{
+	uint32_t	PCR[ 32 ];
+} PORT_Type;
+
+/** LPI2C  */
+typedef struct
+{
+	uint32_t	MSR;			/**< status flags */
+	uint32_t	baudrate;
+	bool		enabled;
+	bool		active;			/**< START issued and no STOP yet */
+	void		*target;		/**< SimDevice which ACKed last address */
+} LPI2C_Type;
+
+/** LPSPI  */
+typedef struct
+{
+	uint32_t	baudrate;
+	uint32_t	TCR;			/**< FRAMESZ only */
+	uint8_t		cpol;
+	uint8_t		cpha;
+	bool		enabled;
+	uint32_t	pcs_to_sck_ns;
+	uint32_t	sck_to_pcs_ns;
+	uint32_t	between_ns;
+	bool		pcs_asserted;	/**< hardware chip-select state */
+} LPSPI_Type;
+
+#define	LPSPI_TCR_FRAMESZ_SHIFT		(0U)
+#define	LPSPI_TCR_FRAMESZ_MASK		(0xFFFU)
+#define	LPSPI_TCR_FRAMESZ( x )		(((uint32_t)(x) << LPSPI_TCR_FRAMESZ_SHIFT) & LPSPI_TCR_FRAMESZ_MASK)
+
+#define	HOST_LPUART_RX_BUF_SIZE	256
+
+/** LPUART  */
+typedef struct
+{
+	uint32_t	baudrate;
+	uint32_t	CTRL;			/**< interrupt enables */
+	uint32_t	STAT;			/**< sticky status flags */
+	bool		tx_enabled;
+	bool		rx_enabled;
+	uint32_t	FIFO;			/**< RXIDEN only */
+	uint8_t		tx_water;
+	uint8_t		rx_water;
+	uint16_t	tx_count;		/**< bytes in TX FIFO, emptied between interrupts */
+	bool		rx_idle;		/**< RX line idle after data */
+	uint8_t		rx_buf[ HOST_LPUART_RX_BUF_SIZE ];
+	uint16_t	rx_head;
+	uint16_t	rx_tail;
+} LPUART_Type;
+
+#define	LPUART_FIFO_RXIDEN_SHIFT	(10U)
+#define	LPUART_FIFO_RXIDEN_MASK		(0x1C00U)
+#define	LPUART_FIFO_RXIDEN( x )		(((uint32_t)(x) << LPUART_FIFO_RXIDEN_SHIFT) & LPUART_FIFO_RXIDEN_MASK)
+
+/** UTICK  */
+typedef struct
+{
+	uint32_t	mode;
+	uint64_t	period_ns;
+	uint64_t	deadline_ns;
+	bool		running;
+	void		(*callback)( void );
+} UTICK_Type;
+
+/** OSTIMER  */
+typedef struct
+{
+	bool		running;
+} OSTIMER_Type;
+
+extern GPIO_Type	host_gpio[ 4 ];
+extern PORT_Type	host_port[ 4 ];
+extern LPI2C_Type	host_lpi2c[ 2 ];
+extern LPSPI_Type	host_lpspi[ 2 ];
+extern LPUART_Type	host_lpuart[ 2 ];
+extern UTICK_Type	host_utick[ 1 ];
+extern OSTIMER_Type	host_ostimer[ 1 ];
+
+#define	GPIO0		(&host_gpio[ 0 ])
+#define	GPIO1		(&host_gpio[ 1 ])
+#define	GPIO2		(&host_gpio[ 2 ])
+#define	GPIO3		(&host_gpio[ 3 ])
+#define	PORT0		(&host_port[ 0 ])
+#define	PORT1		(&host_port[ 1 ])
+#define	PORT2		(&host_port[ 2 ])
+#define	PORT3		(&host_port[ 3 ])
+#define	LPI2C0		(&host_lpi2c[ 0 ])
+#define	LPI2C1		(&host_lpi2c[ 1 ])
+#define	LPSPI0		(&host_lpspi[ 0 ])
+#define	LPSPI1		(&host_lpspi[ 1 ])
+#define	LPUART0		(&host_lpuart[ 0 ])
+#define	LPUART1		(&host_lpuart[ 1 ])
+#define	UTICK0		(&host_utick[ 0 ])
+#define	OSTIMER0	(&host_ostimer[ 0 ])
+
+#define	GPIO_BASE_PTRS		{ GPIO0, GPIO1, GPIO2, GPIO3 }
+#define	PORT_BASE_PTRS		{ PORT0, PORT1, PORT2, PORT3 }
+#define	GPIO_IRQS			{ GPIO0_IRQn, GPIO1_IRQn, GPIO2_IRQn, GPIO3_IRQn }
+#define	LPI2C_BASE_PTRS		{ LPI2C0, LPI2C1 }
+#define	LPSPI_BASE_PTRS		{ LPSPI0, LPSPI1 }
+#define	LPUART_BASE_PTRS	{ LPUART0, LPUART1 }
+#define	LPUART_RX_TX_IRQS	{ LPUART0_IRQn, LPUART1_IRQn }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // R01LIB_HOST_FSL_DEVICE_REGISTERS_H
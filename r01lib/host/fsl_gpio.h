@@ -0,0 +1,67 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso SDK "fsl_gpio.h"
+ */
+
+#ifndef R01LIB_HOST_FSL_GPIO_H
+#define R01LIB_HOST_FSL_GPIO_H
+
+#include	"fsl_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum _gpio_pin_direction
+{
+	kGPIO_DigitalInput	= 0U,
+	kGPIO_DigitalOutput	= 1U,
+} gpio_pin_direction_t;
+
+typedef struct _gpio_pin_config
+{
+	gpio_pin_direction_t	pinDirection;
+	uint8_t					outputLogic;
+} gpio_pin_config_t;
+
+typedef enum _gpio_interrupt_config
+{
+	kGPIO_InterruptStatusFlagDisabled	= 0x0U,
+	kGPIO_InterruptLogicZero			= 0x8U,
+	kGPIO_InterruptRisingEdge			= 0x9U,
+	kGPIO_InterruptFallingEdge			= 0xAU,
+	kGPIO_InterruptEitherEdge			= 0xBU,
+	kGPIO_InterruptLogicOne				= 0xCU,
+} gpio_interrupt_config_t;
+
+void		GPIO_PinInit( GPIO_Type *base, uint32_t pin, const gpio_pin_config_t *config );
+void		GPIO_PinWrite( GPIO_Type *base, uint32_t pin, uint8_t output );
+uint32_t	GPIO_PinRead( GPIO_Type *base, uint32_t pin );
+void		GPIO_SetPinInterruptConfig( GPIO_Type *base, uint32_t pin, gpio_interrupt_config_t config );
+uint32_t	GPIO_GpioGetInterruptFlags( GPIO_Type *base );
+void		GPIO_GpioClearInterruptFlags( GPIO_Type *base, uint32_t mask );
+
+static inline void	GPIO_PortSet( GPIO_Type *base, uint32_t mask )
+{
+	for ( uint32_t i = 0; i < 32; i++ )
+		if ( mask & (1UL << i) )
+			GPIO_PinWrite( base, i, 1 );
+}
+
+static inline void	GPIO_PortClear( GPIO_Type *base, uint32_t mask )
+{
+	for ( uint32_t i = 0; i < 32; i++ )
+		if ( mask & (1UL << i) )
+			GPIO_PinWrite( base, i, 0 );
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // R01LIB_HOST_FSL_GPIO_H
@@ -0,0 +1,133 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso SDK "fsl_lpi2c.h" (master functions only)
+ *	Transactions are performed on simulated bus with devices registered by SimBus::attach()
+ */
+
+#ifndef R01LIB_HOST_FSL_LPI2C_H
+#define R01LIB_HOST_FSL_LPI2C_H
+
+#include	"fsl_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum
+{
+	kStatus_LPI2C_Busy					= MAKE_STATUS( kStatusGroup_LPI2C, 0 ),
+	kStatus_LPI2C_Idle					= MAKE_STATUS( kStatusGroup_LPI2C, 1 ),
+	kStatus_LPI2C_Nak					= MAKE_STATUS( kStatusGroup_LPI2C, 2 ),
+	kStatus_LPI2C_FifoError				= MAKE_STATUS( kStatusGroup_LPI2C, 3 ),
+	kStatus_LPI2C_BitError				= MAKE_STATUS( kStatusGroup_LPI2C, 4 ),
+	kStatus_LPI2C_ArbitrationLost		= MAKE_STATUS( kStatusGroup_LPI2C, 5 ),
+	kStatus_LPI2C_PinLowTimeout			= MAKE_STATUS( kStatusGroup_LPI2C, 6 ),
+	kStatus_LPI2C_NoTransferInProgress	= MAKE_STATUS( kStatusGroup_LPI2C, 7 ),
+	kStatus_LPI2C_DmaRequestFail		= MAKE_STATUS( kStatusGroup_LPI2C, 8 ),
+	kStatus_LPI2C_Timeout				= MAKE_STATUS( kStatusGroup_LPI2C, 9 ),
+};
+
+enum _lpi2c_master_flags
+{
+	kLPI2C_MasterTxReadyFlag			= 1U << 0,
+	kLPI2C_MasterRxReadyFlag			= 1U << 1,
+	kLPI2C_MasterEndOfPacketFlag		= 1U << 8,
+	kLPI2C_MasterStopDetectFlag			= 1U << 9,
+	kLPI2C_MasterNackDetectFlag			= 1U << 10,
+	kLPI2C_MasterArbitrationLostFlag	= 1U << 11,
+	kLPI2C_MasterFifoErrFlag			= 1U << 12,
+	kLPI2C_MasterPinLowTimeoutFlag		= 1U << 13,
+	kLPI2C_MasterDataMatchFlag			= 1U << 14,
+	kLPI2C_MasterBusyFlag				= 1U << 24,
+	kLPI2C_MasterBusBusyFlag			= 1U << 25,
+};
+
+typedef enum _lpi2c_direction
+{
+	kLPI2C_Write	= 0U,
+	kLPI2C_Read		= 1U,
+} lpi2c_direction_t;
+
+enum _lpi2c_master_transfer_flags
+{
+	kLPI2C_TransferDefaultFlag			= 0x00U,
+	kLPI2C_TransferNoStartFlag			= 0x01U,
+	kLPI2C_TransferRepeatedStartFlag	= 0x02U,
+	kLPI2C_TransferNoStopFlag			= 0x04U,
+};
+
+typedef struct _lpi2c_master_config
+{
+	bool		enableMaster;
+	bool		enableDoze;
+	bool		debugEnable;
+	bool		ignoreAck;
+	uint32_t	baudRate_Hz;
+	uint32_t	busIdleTimeout_ns;
+	uint32_t	pinLowTimeout_ns;
+	uint8_t		sdaGlitchFilterWidth_ns;
+	uint8_t		sclGlitchFilterWidth_ns;
+} lpi2c_master_config_t;
+
+typedef struct _lpi2c_master_transfer
+{
+	uint32_t			flags;
+	uint16_t			slaveAddress;
+	lpi2c_direction_t	direction;
+	uint32_t			subaddress;
+	size_t				subaddressSize;
+	void				*data;
+	size_t				dataSize;
+} lpi2c_master_transfer_t;
+
+typedef struct _lpi2c_master_handle	lpi2c_master_handle_t;
+
+typedef void (*lpi2c_master_transfer_callback_t)( LPI2C_Type *base, lpi2c_master_handle_t *handle, status_t completionStatus, void *userData );
+
+struct _lpi2c_master_handle
+{
+	uint8_t								state;
+	lpi2c_master_transfer_t				transfer;
+	lpi2c_master_transfer_callback_t	completionCallback;
+	void								*userData;
+};
+
+void		LPI2C_MasterGetDefaultConfig( lpi2c_master_config_t *masterConfig );
+void		LPI2C_MasterInit( LPI2C_Type *base, const lpi2c_master_config_t *masterConfig, uint32_t sourceClock_Hz );
+void		LPI2C_MasterDeinit( LPI2C_Type *base );
+void		LPI2C_MasterSetBaudRate( LPI2C_Type *base, uint32_t sourceClock_Hz, uint32_t baudRate_Hz );
+
+uint32_t	LPI2C_MasterGetStatusFlags( LPI2C_Type *base );
+void		LPI2C_MasterClearStatusFlags( LPI2C_Type *base, uint32_t statusMask );
+void		LPI2C_MasterGetFifoCounts( LPI2C_Type *base, size_t *rxCount, size_t *txCount );
+
+status_t	LPI2C_MasterStart( LPI2C_Type *base, uint8_t address, lpi2c_direction_t dir );
+status_t	LPI2C_MasterStop( LPI2C_Type *base );
+status_t	LPI2C_MasterSend( LPI2C_Type *base, void *txBuff, size_t txSize );
+status_t	LPI2C_MasterReceive( LPI2C_Type *base, void *rxBuff, size_t rxSize );
+
+static inline status_t	LPI2C_MasterRepeatedStart( LPI2C_Type *base, uint8_t address, lpi2c_direction_t dir )
+{
+	return LPI2C_MasterStart( base, address, dir );
+}
+
+status_t	LPI2C_MasterTransferBlocking( LPI2C_Type *base, lpi2c_master_transfer_t *transfer );
+
+/** Non-blocking transfer
+ *	On host, the transfer proceeds by FIFO-size words in the simulated LPI2C interrupt as the time advances
+ *	and the callback is called from the interrupt. Read data is given to the buffer at completion
+ */
+void		LPI2C_MasterTransferCreateHandle( LPI2C_Type *base, lpi2c_master_handle_t *handle, lpi2c_master_transfer_callback_t callback, void *userData );
+status_t	LPI2C_MasterTransferNonBlocking( LPI2C_Type *base, lpi2c_master_handle_t *handle, lpi2c_master_transfer_t *transfer );
+void		LPI2C_MasterTransferAbort( LPI2C_Type *base, lpi2c_master_handle_t *handle );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // R01LIB_HOST_FSL_LPI2C_H
@@ -0,0 +1,130 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso SDK "fsl_lpspi.h" (master functions only)
+ *	Transactions are performed on simulated bus with devices registered by SimBus::attach()
+ */
+
+#ifndef R01LIB_HOST_FSL_LPSPI_H
+#define R01LIB_HOST_FSL_LPSPI_H
+
+#include	"fsl_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum
+{
+	kStatus_LPSPI_Busy		= MAKE_STATUS( kStatusGroup_LPSPI, 0 ),
+	kStatus_LPSPI_Error		= MAKE_STATUS( kStatusGroup_LPSPI, 1 ),
+	kStatus_LPSPI_Idle		= MAKE_STATUS( kStatusGroup_LPSPI, 2 ),
+	kStatus_LPSPI_OutOfRange= MAKE_STATUS( kStatusGroup_LPSPI, 3 ),
+	kStatus_LPSPI_Timeout	= MAKE_STATUS( kStatusGroup_LPSPI, 4 ),
+};
+
+typedef enum _lpspi_clock_polarity
+{
+	kLPSPI_ClockPolarityActiveHigh	= 0U,
+	kLPSPI_ClockPolarityActiveLow	= 1U,
+} lpspi_clock_polarity_t;
+
+typedef enum _lpspi_clock_phase
+{
+	kLPSPI_ClockPhaseFirstEdge	= 0U,
+	kLPSPI_ClockPhaseSecondEdge	= 1U,
+} lpspi_clock_phase_t;
+
+typedef enum _lpspi_shift_direction
+{
+	kLPSPI_MsbFirst	= 0U,
+	kLPSPI_LsbFirst	= 1U,
+} lpspi_shift_direction_t;
+
+typedef enum _lpspi_which_pcs_config
+{
+	kLPSPI_Pcs0	= 0U,
+	kLPSPI_Pcs1	= 1U,
+	kLPSPI_Pcs2	= 2U,
+	kLPSPI_Pcs3	= 3U,
+} lpspi_which_pcs_t;
+
+typedef enum _lpspi_pcs_polarity_config
+{
+	kLPSPI_PcsActiveHigh	= 1U,
+	kLPSPI_PcsActiveLow		= 0U,
+} lpspi_pcs_polarity_config_t;
+
+#define	LPSPI_MASTER_PCS_SHIFT	(4U)
+#define	LPSPI_MASTER_PCS_MASK	(0xF0U)
+
+enum _lpspi_transfer_config_flag_for_master
+{
+	kLPSPI_MasterPcs0			= 0U << LPSPI_MASTER_PCS_SHIFT,
+	kLPSPI_MasterPcs1			= 1U << LPSPI_MASTER_PCS_SHIFT,
+	kLPSPI_MasterPcs2			= 2U << LPSPI_MASTER_PCS_SHIFT,
+	kLPSPI_MasterPcs3			= 3U << LPSPI_MASTER_PCS_SHIFT,
+	kLPSPI_MasterPcsContinuous	= 1U << 20,
+	kLPSPI_MasterByteSwap		= 1U << 22,
+};
+
+typedef struct _lpspi_master_config
+{
+	uint32_t					baudRate;
+	uint32_t					bitsPerFrame;
+	lpspi_clock_polarity_t		cpol;
+	lpspi_clock_phase_t			cpha;
+	lpspi_shift_direction_t		direction;
+	uint32_t					pcsToSckDelayInNanoSec;
+	uint32_t					lastSckToPcsDelayInNanoSec;
+	uint32_t					betweenTransferDelayInNanoSec;
+	lpspi_which_pcs_t			whichPcs;
+	lpspi_pcs_polarity_config_t	pcsActiveHighOrLow;
+} lpspi_master_config_t;
+
+typedef struct _lpspi_transfer
+{
+	const uint8_t	*txData;
+	uint8_t			*rxData;
+	volatile size_t	dataSize;
+	uint32_t		configFlags;
+} lpspi_transfer_t;
+
+typedef struct _lpspi_master_handle	lpspi_master_handle_t;
+
+typedef void (*lpspi_master_transfer_callback_t)( LPSPI_Type *base, lpspi_master_handle_t *handle, status_t status, void *userData );
+
+struct _lpspi_master_handle
+{
+	volatile uint8_t					state;
+	lpspi_transfer_t					transfer;
+	lpspi_master_transfer_callback_t	callback;
+	void								*userData;
+};
+
+void		LPSPI_MasterGetDefaultConfig( lpspi_master_config_t *masterConfig );
+void		LPSPI_MasterInit( LPSPI_Type *base, const lpspi_master_config_t *masterConfig, uint32_t srcClock_Hz );
+void		LPSPI_Deinit( LPSPI_Type *base );
+
+/** Blocking transfer
+ *	When kLPSPI_MasterPcsContinuous is not given, chip-select is toggled for each frame (bitsPerFrame)
+ */
+status_t	LPSPI_MasterTransferBlocking( LPSPI_Type *base, lpspi_transfer_t *transfer );
+
+/** Non-blocking transfer
+ *	On host, the transfer proceeds by FIFO-size frames in the simulated LPSPI interrupt as the time advances
+ *	and the callback is called from the interrupt. Read data is given to the buffer at completion
+ */
+void		LPSPI_MasterTransferCreateHandle( LPSPI_Type *base, lpspi_master_handle_t *handle, lpspi_master_transfer_callback_t callback, void *userData );
+status_t	LPSPI_MasterTransferNonBlocking( LPSPI_Type *base, lpspi_master_handle_t *handle, lpspi_transfer_t *transfer );
+void		LPSPI_MasterTransferAbort( LPSPI_Type *base, lpspi_master_handle_t *handle );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // R01LIB_HOST_FSL_LPSPI_H
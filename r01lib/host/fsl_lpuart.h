@@ -0,0 +1,110 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso SDK "fsl_lpuart.h"
+ *	Transmitted data goes to the sink set by SimUART::sink(), received data is given by SimUART::input()
+ *	FIFO: TX FIFO is emptied each time before interrupts are checked. RX FIFO holds all data given by SimUART::input()
+ */
+
+#ifndef R01LIB_HOST_FSL_LPUART_H
+#define R01LIB_HOST_FSL_LPUART_H
+
+#include	"fsl_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum
+{
+	kStatus_LPUART_TxBusy				= MAKE_STATUS( kStatusGroup_LPUART, 0 ),
+	kStatus_LPUART_RxBusy				= MAKE_STATUS( kStatusGroup_LPUART, 1 ),
+	kStatus_LPUART_TxIdle				= MAKE_STATUS( kStatusGroup_LPUART, 2 ),
+	kStatus_LPUART_RxIdle				= MAKE_STATUS( kStatusGroup_LPUART, 3 ),
+	kStatus_LPUART_RxHardwareOverrun	= MAKE_STATUS( kStatusGroup_LPUART, 8 ),
+	kStatus_LPUART_Timeout				= MAKE_STATUS( kStatusGroup_LPUART, 16 ),
+};
+
+enum _lpuart_interrupt_enable
+{
+	kLPUART_IdleLineInterruptEnable				= 1U << 20,
+	kLPUART_RxDataRegFullInterruptEnable		= 1U << 21,
+	kLPUART_TransmissionCompleteInterruptEnable	= 1U << 22,
+	kLPUART_TxDataRegEmptyInterruptEnable		= 1U << 23,
+	kLPUART_RxOverrunInterruptEnable			= 1U << 27,
+};
+
+enum _lpuart_flags
+{
+	kLPUART_RxOverrunFlag				= 1U << 19,
+	kLPUART_IdleLineFlag				= 1U << 20,
+	kLPUART_RxDataRegFullFlag			= 1U << 21,
+	kLPUART_TransmissionCompleteFlag	= 1U << 22,
+	kLPUART_TxDataRegEmptyFlag			= 1U << 23,
+};
+
+typedef enum _lpuart_parity_mode
+{
+	kLPUART_ParityDisabled	= 0x0U,
+	kLPUART_ParityEven		= 0x2U,
+	kLPUART_ParityOdd		= 0x3U,
+} lpuart_parity_mode_t;
+
+typedef enum _lpuart_data_bits
+{
+	kLPUART_EightDataBits	= 0x0U,
+	kLPUART_SevenDataBits	= 0x1U,
+} lpuart_data_bits_t;
+
+typedef enum _lpuart_stop_bit_count
+{
+	kLPUART_OneStopBit	= 0U,
+	kLPUART_TwoStopBit	= 1U,
+} lpuart_stop_bit_count_t;
+
+typedef struct _lpuart_config
+{
+	uint32_t				baudRate_Bps;
+	lpuart_parity_mode_t	parityMode;
+	lpuart_data_bits_t		dataBitsCount;
+	bool					isMsb;
+	lpuart_stop_bit_count_t	stopBitCount;
+	uint8_t					txFifoWatermark;
+	uint8_t					rxFifoWatermark;
+	bool					enableTx;
+	bool					enableRx;
+} lpuart_config_t;
+
+void		LPUART_GetDefaultConfig( lpuart_config_t *config );
+status_t	LPUART_Init( LPUART_Type *base, const lpuart_config_t *config, uint32_t srcClock_Hz );
+void		LPUART_Deinit( LPUART_Type *base );
+
+void		LPUART_EnableInterrupts( LPUART_Type *base, uint32_t mask );
+void		LPUART_DisableInterrupts( LPUART_Type *base, uint32_t mask );
+uint32_t	LPUART_GetEnabledInterrupts( LPUART_Type *base );
+
+uint32_t	LPUART_GetStatusFlags( LPUART_Type *base );
+status_t	LPUART_ClearStatusFlags( LPUART_Type *base, uint32_t mask );
+
+uint32_t	LPUART_GetTxFifoCount( LPUART_Type *base );
+uint32_t	LPUART_GetRxFifoCount( LPUART_Type *base );
+
+void		LPUART_WriteByte( LPUART_Type *base, uint8_t data );
+uint8_t		LPUART_ReadByte( LPUART_Type *base );
+
+status_t	LPUART_WriteBlocking( LPUART_Type *base, const uint8_t *data, size_t length );
+
+/** Blocking read
+ *	On host, returns kStatus_LPUART_Timeout if not enough data was given by SimUART::input()
+ */
+status_t	LPUART_ReadBlocking( LPUART_Type *base, uint8_t *data, size_t length );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // R01LIB_HOST_FSL_LPUART_H
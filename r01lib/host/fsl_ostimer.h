@@ -0,0 +1,35 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso SDK "fsl_ostimer.h"
+ *	The 42 bit counter runs at 1MHz on simulated time, including the time in __WFI()
+ */
+
+#ifndef R01LIB_HOST_FSL_OSTIMER_H
+#define R01LIB_HOST_FSL_OSTIMER_H
+
+#include	"fsl_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void		OSTIMER_Init( OSTIMER_Type *base );
+void		OSTIMER_Deinit( OSTIMER_Type *base );
+
+/** Counter value
+ *
+ * @param base OSTIMER instance
+ * @return 42 bit counter value in micro-seconds
+ */
+uint64_t	OSTIMER_GetCurrentTimerValue( OSTIMER_Type *base );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // R01LIB_HOST_FSL_OSTIMER_H
@@ -0,0 +1,52 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso SDK "fsl_port.h"
+ */
+
+#ifndef R01LIB_HOST_FSL_PORT_H
+#define R01LIB_HOST_FSL_PORT_H
+
+#include	"fsl_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define	PORT_PCR_PS_MASK		(0x1U)
+#define	PORT_PCR_PS( x )		(((uint32_t)(x) << 0) & PORT_PCR_PS_MASK)
+#define	PORT_PCR_PE_MASK		(0x2U)
+#define	PORT_PCR_PE( x )		(((uint32_t)(x) << 1) & PORT_PCR_PE_MASK)
+#define	PORT_PCR_ODE_MASK		(0x20U)
+#define	PORT_PCR_ODE( x )		(((uint32_t)(x) << 5) & PORT_PCR_ODE_MASK)
+#define	PORT_PCR_MUX_MASK		(0xF00U)
+#define	PORT_PCR_MUX_SHIFT		(8U)
+#define	PORT_PCR_MUX( x )		(((uint32_t)(x) << PORT_PCR_MUX_SHIFT) & PORT_PCR_MUX_MASK)
+
+typedef enum _port_mux
+{
+	kPORT_MuxAlt0	= 0U,
+	kPORT_MuxAlt1	= 1U,
+	kPORT_MuxAlt2	= 2U,
+	kPORT_MuxAlt3	= 3U,
+	kPORT_MuxAlt4	= 4U,
+	kPORT_MuxAlt5	= 5U,
+	kPORT_MuxAlt6	= 6U,
+	kPORT_MuxAlt7	= 7U,
+	kPORT_MuxAsGpio	= kPORT_MuxAlt0,
+} port_mux_t;
+
+/** Pin mux setting
+ *	Changing a SPI chip-select pin between GPIO and peripheral function is informed to simulated bus
+ */
+void	PORT_SetPinMux( PORT_Type *base, uint32_t pin, port_mux_t mux );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // R01LIB_HOST_FSL_PORT_H
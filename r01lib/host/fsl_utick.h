@@ -0,0 +1,45 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso SDK "fsl_utick.h"
+ *	The timer runs on simulated time. Callbacks are called while the time advances in wait()
+ */
+
+#ifndef R01LIB_HOST_FSL_UTICK_H
+#define R01LIB_HOST_FSL_UTICK_H
+
+#include	"fsl_common.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum _utick_mode
+{
+	kUTICK_Onetime	= 0x0U,
+	kUTICK_Repeat	= 0x1U,
+} utick_mode_t;
+
+typedef void (*utick_callback_t)( void );
+
+void	UTICK_Init( UTICK_Type *base );
+void	UTICK_Deinit( UTICK_Type *base );
+
+/** Timer setting
+ *
+ * @param base UTICK instance
+ * @param mode kUTICK_Onetime or kUTICK_Repeat
+ * @param count (period in micro-seconds) - 1
+ * @param cb callback function
+ */
+void	UTICK_SetTick( UTICK_Type *base, utick_mode_t mode, uint32_t count, utick_callback_t cb );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // R01LIB_HOST_FSL_UTICK_H
@@ -0,0 +1,1492 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Simulation environment and SDK driver functions for host (CPU_HOST) build
+ *
+ *	Pin number on host is "1 + port * 32 + bit" (see io.h)
+ *	Interrupts are emulated: a handler is called when the interrupt is enabled and its condition is met.
+ *	Handlers are not nested. A condition which is met in a handler is served after the handler returned.
+ *
+ *	Non-blocking LPI2C/LPSPI transfers are modeled by FIFO: words (bytes or frames) are exchanged with devices
+ *	when the FIFO is loaded and the interrupt is raised when they have been shifted out on the bus.
+ *	Next FIFO-full is loaded in the interrupt, and the callback is called from the interrupt after the last one.
+ */
+
+#include	<stdio.h>
+#include	<vector>
+#include	<map>
+#include	<functional>
+
+#include	"fsl_common.h"
+#include	"fsl_clock.h"
+#include	"fsl_port.h"
+#include	"fsl_gpio.h"
+#include	"fsl_utick.h"
+#include	"fsl_ostimer.h"
+#include	"board.h"
+#include	"pin_mux.h"
+#include	"clock_config.h"
+#include	"peripherals.h"
+#include	"host_sim.h"
+
+GPIO_Type	host_gpio[ 4 ];
+PORT_Type	host_port[ 4 ];
+LPI2C_Type	host_lpi2c[ 2 ];
+LPSPI_Type	host_lpspi[ 2 ];
+LPUART_Type	host_lpuart[ 2 ];
+UTICK_Type	host_utick[ 1 ];
+OSTIMER_Type	host_ostimer[ 1 ];
+
+extern "C" {
+void GPIO0_IRQHandler( void )	__attribute__((weak));
+void GPIO1_IRQHandler( void )	__attribute__((weak));
+void GPIO2_IRQHandler( void )	__attribute__((weak));
+void GPIO3_IRQHandler( void )	__attribute__((weak));
+void LPUART0_IRQHandler( void )	__attribute__((weak));
+void LPUART1_IRQHandler( void )	__attribute__((weak));
+}
+
+#define	N_PORT		4
+#define	PORT_BITS	32
+
+typedef struct	_i2c_entry {
+	LPI2C_Type	*bus;
+	uint8_t		address;
+	SimDevice	*device;
+} i2c_entry;
+
+typedef struct	_spi_entry {
+	LPSPI_Type	*bus;
+	int			cs_pin;
+	SimDevice	*device;
+	bool		selected;
+} spi_entry;
+
+typedef struct	_bus_job {
+	bool									active;
+	bool									pending;		//	FIFO drained, interrupt is pending
+	uint64_t								deadline_ns;
+	size_t									fifo;
+	std::vector<std::function<status_t()>>	words;
+	size_t									pos;
+	status_t								status;
+	std::function<void()>					abort;			//	called when a word failed
+	std::vector<uint8_t>					rx;				//	read data is given to the caller at completion
+	uint8_t									*rx_dest;
+	std::function<void( status_t )>			done;
+} bus_job;
+
+/*	function-local statics: r01lib starts before main() and static objects may not be constructed yet	*/
+static std::vector<i2c_entry>&					i2c_devices( void )	{ static std::vector<i2c_entry>	v; return v; }
+static std::vector<spi_entry>&					spi_devices( void )	{ static std::vector<spi_entry>	v; return v; }
+static std::map<int, SimGPIO::watch_cb_t>&		pin_watchers( void )	{ static std::map<int, SimGPIO::watch_cb_t>	m; return m; }
+static std::map<LPUART_Type*, SimUART::sink_cb_t>&	uart_sinks( void )	{ static std::map<LPUART_Type*, SimUART::sink_cb_t>	m; return m; }
+static std::map<const void*, SimBusStats>&		bus_stats( void )	{ static std::map<const void*, SimBusStats>	m; return m; }
+static std::map<int, bus_job>&					bus_jobs( void )	{ static std::map<int, bus_job>	m; return m; }
+
+static uint64_t	sim_time_ns		= 0;
+static uint64_t	sleep_ns		= 0;
+static bool		irq_enabled[ NUMBER_OF_INT_VECTORS ];
+static bool		utick_pending	= false;
+static uint32_t	primask			= 0;
+static bool		in_handler		= false;
+static uint32_t	irq_count[ NUMBER_OF_INT_VECTORS ];
+static uint64_t	*deferred_ns	= NULL;
+
+
+/*
+ *	pins
+ */
+
+static bool pin_decode( int pin, int& port, int& bit )
+{
+	if ( (pin < 1) || (N_PORT * PORT_BITS < pin) )
+		return false;
+
+	port	= (pin - 1) / PORT_BITS;
+	bit		= (pin - 1) % PORT_BITS;
+
+	return true;
+}
+
+static int pin_encode( int port, int bit )
+{
+	return 1 + port * PORT_BITS + bit;
+}
+
+static bool pin_is_gpio( int port, int bit )
+{
+	return 0 == ((host_port[ port ].PCR[ bit ] & PORT_PCR_MUX_MASK) >> PORT_PCR_MUX_SHIFT);
+}
+
+/*	bus time: bit-times at the bus frequency and fixed delays. The simulated time advances by it
+	(or it is accumulated for the interrupt timing while a FIFO is loaded)	*/
+static void bus_time( const void *bus, uint32_t frequency, uint64_t bits, uint64_t delay_ns = 0 )
+{
+	SimBusStats	&s	= bus_stats()[ bus ];
+	uint64_t	ns	= delay_ns;
+
+	if ( frequency )
+		ns	+= (bits * 1000000000ULL + frequency - 1) / frequency;
+
+	s.bits		+= bits;
+	s.time_ns	+= ns;
+
+	if ( deferred_ns )
+		*deferred_ns	+= ns;
+	else
+		SimClock::advance_ns( ns );
+}
+
+/*	executes words of a transfer. The transfer is aborted at a failed word	*/
+static status_t job_exec( bus_job& j, size_t n )
+{
+	for ( ; n && (j.pos < j.words.size()); n-- )
+	{
+		if ( kStatus_Success != (j.status = j.words[ j.pos++ ]()) )
+		{
+			j.pos	= j.words.size();
+
+			if ( j.abort )
+				j.abort();
+		}
+	}
+
+	return j.status;
+}
+
+/*	loads next FIFO-full. The interrupt is raised after the time of the words on the bus	*/
+static void job_load( bus_job& j )
+{
+	uint64_t	ns	= 0;
+
+	deferred_ns	= &ns;
+	job_exec( j, j.fifo );
+	deferred_ns	= NULL;
+
+	j.pending		= false;
+	j.deadline_ns	= sim_time_ns + ns;
+}
+
+static void job_start( bus_job& j, size_t fifo, uint8_t *rx_dest, std::function<void( status_t )> done )
+{
+	j.active	= true;
+	j.fifo		= fifo;
+	j.pos		= 0;
+	j.status	= kStatus_Success;
+	j.rx_dest	= rx_dest;
+	j.done		= done;
+
+	job_load( j );
+}
+
+static void job_irq( bus_job& j )
+{
+	j.pending	= false;
+
+	if ( j.pos < j.words.size() )
+	{
+		job_load( j );
+		return;
+	}
+
+	j.active	= false;
+
+	if ( j.rx_dest )
+		memcpy( j.rx_dest, j.rx.data(), j.rx.size() );
+
+	if ( j.done )
+		j.done( j.status );
+}
+
+/*	the earliest time of UTICK expiration or FIFO drain	*/
+static uint64_t next_event_ns( void )
+{
+	uint64_t	e	= UINT64_MAX;
+
+	if ( UTICK0->running )
+		e	= UTICK0->deadline_ns;
+
+	for ( auto& j : bus_jobs() )
+		if ( j.second.active && !j.second.pending && (j.second.deadline_ns < e) )
+			e	= j.second.deadline_ns;
+
+	return e;
+}
+
+/*	SPI chip-select: selected when the pin is GPIO output with low level or hardware chip-select is asserted	*/
+static void spi_cs_update( void )
+{
+	int	port, bit;
+
+	for ( auto& e : spi_devices() )
+	{
+		if ( !pin_decode( e.cs_pin, port, bit ) )
+			continue;
+
+		GPIO_Type	*g	= &host_gpio[ port ];
+		bool		s;
+
+		if ( pin_is_gpio( port, bit ) )
+			s	= (g->PDDR & (1UL << bit)) && !(g->PDOR & (1UL << bit));
+		else
+			s	= e.bus->pcs_asserted;
+
+		if ( s != e.selected )
+		{
+			e.selected	= s;
+			e.device->spi_select( s );
+
+			if ( s )
+				bus_stats()[ e.bus ].transactions++;
+		}
+	}
+}
+
+
+/*
+ *	interrupts
+ */
+
+static bool irq_pending( int n )
+{
+	switch ( n )
+	{
+		case GPIO0_IRQn:
+		case GPIO1_IRQn:
+		case GPIO2_IRQn:
+		case GPIO3_IRQn:
+			return 0 != host_gpio[ n - GPIO0_IRQn ].ISFR;
+
+		case LPUART0_IRQn:
+		case LPUART1_IRQn:
+		{
+			LPUART_Type	*u		= &host_lpuart[ n - LPUART0_IRQn ];
+			uint32_t	flags	= LPUART_GetStatusFlags( u );
+			uint32_t	events	= kLPUART_IdleLineFlag | kLPUART_RxDataRegFullFlag | kLPUART_TransmissionCompleteFlag | kLPUART_TxDataRegEmptyFlag;
+
+			if ( flags & u->CTRL & events )
+				return true;
+
+			return (u->CTRL & kLPUART_RxOverrunInterruptEnable) && (flags & kLPUART_RxOverrunFlag);
+		}
+
+		case UTICK0_IRQn:
+			return utick_pending;
+
+		case LPI2C0_IRQn:
+		case LPI2C1_IRQn:
+		case LPSPI0_IRQn:
+		case LPSPI1_IRQn:
+		{
+			auto	j	= bus_jobs().find( n );
+
+			return (j != bus_jobs().end()) && j->second.pending;
+		}
+
+		default:
+			return false;
+	}
+}
+
+static void irq_call( int n )
+{
+	irq_count[ n ]++;
+
+	void	(*gpio_handlers[])( void )		= { GPIO0_IRQHandler, GPIO1_IRQHandler, GPIO2_IRQHandler, GPIO3_IRQHandler };
+	void	(*lpuart_handlers[])( void )	= { LPUART0_IRQHandler, LPUART1_IRQHandler };
+
+	switch ( n )
+	{
+		case GPIO0_IRQn:
+		case GPIO1_IRQn:
+		case GPIO2_IRQn:
+		case GPIO3_IRQn:
+			if ( gpio_handlers[ n - GPIO0_IRQn ] )
+				gpio_handlers[ n - GPIO0_IRQn ]();
+			else
+				host_gpio[ n - GPIO0_IRQn ].ISFR	= 0;
+			break;
+
+		case LPUART0_IRQn:
+		case LPUART1_IRQn:
+			if ( lpuart_handlers[ n - LPUART0_IRQn ] )
+				lpuart_handlers[ n - LPUART0_IRQn ]();
+			else
+				host_lpuart[ n - LPUART0_IRQn ].CTRL	= 0;
+			break;
+
+		case UTICK0_IRQn:
+			utick_pending	= false;
+			if ( UTICK0->callback )
+				UTICK0->callback();
+			break;
+
+		case LPI2C0_IRQn:
+		case LPI2C1_IRQn:
+		case LPSPI0_IRQn:
+		case LPSPI1_IRQn:
+			job_irq( bus_jobs()[ n ] );
+			break;
+
+		default:
+			break;
+	}
+}
+
+static void irq_service( void )
+{
+	if ( in_handler || primask )
+		return;
+
+	in_handler	= true;
+
+	bool	served;
+
+	do
+	{
+		served	= false;
+
+		//	transmitters send out FIFO contents between interrupts
+		for ( auto& u : host_lpuart )
+			u.tx_count	= 0;
+
+		for ( int n = 0; n < NUMBER_OF_INT_VECTORS; n++ )
+		{
+			if ( irq_enabled[ n ] && irq_pending( n ) )
+			{
+				irq_call( n );
+				served	= true;
+			}
+		}
+	}
+	while ( served );
+
+	in_handler	= false;
+}
+
+extern "C" {
+
+status_t EnableIRQ( IRQn_Type interrupt )
+{
+	if ( (interrupt < 0) || (NUMBER_OF_INT_VECTORS <= interrupt) )
+		return kStatus_Fail;
+
+	irq_enabled[ interrupt ]	= true;
+	irq_service();
+
+	return kStatus_Success;
+}
+
+status_t DisableIRQ( IRQn_Type interrupt )
+{
+	if ( (interrupt < 0) || (NUMBER_OF_INT_VECTORS <= interrupt) )
+		return kStatus_Fail;
+
+	irq_enabled[ interrupt ]	= false;
+
+	return kStatus_Success;
+}
+
+uint32_t DisableGlobalIRQ( void )
+{
+	uint32_t	previous	= primask;
+
+	primask	= 1;
+
+	return previous;
+}
+
+void EnableGlobalIRQ( uint32_t mask )
+{
+	primask	= mask;
+	irq_service();
+}
+
+void __disable_irq( void )
+{
+	primask	= 1;
+}
+
+void __enable_irq( void )
+{
+	primask	= 0;
+	irq_service();
+}
+
+void __WFI( void )
+{
+	uint64_t	e	= next_event_ns();
+	uint64_t	t	= sim_time_ns;
+
+	if ( (UINT64_MAX != e) && (sim_time_ns < e) )
+		SimClock::advance_ns( e - sim_time_ns );
+	else
+		SimClock::advance_ns( 1000 );
+
+	//	core clock is stopped in sleep
+	sleep_ns	+= sim_time_ns - t;
+}
+
+void SDK_DelayAtLeastUs( uint32_t delayTime_us, uint32_t )
+{
+	SimClock::advance_ns( (uint64_t)delayTime_us * 1000ULL );
+}
+
+
+/*
+ *	board
+ */
+
+void BOARD_InitBootPins( void ) {}
+void BOARD_InitPins( void ) {}
+void BOARD_InitBootClocks( void ) {}
+void BOARD_InitBootPeripherals( void ) {}
+void BOARD_InitDebugConsole( void ) {}
+
+
+/*
+ *	PORT and GPIO
+ */
+
+void PORT_SetPinMux( PORT_Type *base, uint32_t pin, port_mux_t mux )
+{
+	base->PCR[ pin ]	= (base->PCR[ pin ] & ~PORT_PCR_MUX_MASK) | PORT_PCR_MUX( mux );
+	spi_cs_update();
+}
+
+void GPIO_PinInit( GPIO_Type *base, uint32_t pin, const gpio_pin_config_t *config )
+{
+	if ( kGPIO_DigitalOutput == config->pinDirection )
+	{
+		GPIO_PinWrite( base, pin, config->outputLogic );
+		base->PDDR	|= 1UL << pin;
+	}
+	else
+	{
+		base->PDDR	&= ~(1UL << pin);
+	}
+
+	spi_cs_update();
+}
+
+void GPIO_PinWrite( GPIO_Type *base, uint32_t pin, uint8_t output )
+{
+	uint32_t	bit		= 1UL << pin;
+	uint32_t	prev	= base->PDOR;
+
+	if ( output )
+		base->PDOR	|= bit;
+	else
+		base->PDOR	&= ~bit;
+
+	if ( prev == base->PDOR )
+		return;
+
+	spi_cs_update();
+
+	auto	w	= pin_watchers().find( pin_encode( base - host_gpio, pin ) );
+
+	if ( (w != pin_watchers().end()) && w->second )
+		w->second( output ? true : false );
+}
+
+uint32_t GPIO_PinRead( GPIO_Type *base, uint32_t pin )
+{
+	uint32_t	bit		= 1UL << pin;
+	uint32_t	level	= (base->PDDR & bit) ? base->PDOR : base->PDIR;
+
+	return (level & bit) ? 1 : 0;
+}
+
+void GPIO_SetPinInterruptConfig( GPIO_Type *base, uint32_t pin, gpio_interrupt_config_t config )
+{
+	base->ICR[ pin ]	= config;
+}
+
+uint32_t GPIO_GpioGetInterruptFlags( GPIO_Type *base )
+{
+	return base->ISFR;
+}
+
+void GPIO_GpioClearInterruptFlags( GPIO_Type *base, uint32_t mask )
+{
+	base->ISFR	&= ~mask;
+}
+
+
+/*
+ *	UTICK
+ */
+
+void UTICK_Init( UTICK_Type *base )
+{
+	base->running	= false;
+	base->callback	= NULL;
+	irq_enabled[ UTICK0_IRQn ]	= true;
+}
+
+void UTICK_Deinit( UTICK_Type *base )
+{
+	base->running	= false;
+	irq_enabled[ UTICK0_IRQn ]	= false;
+}
+
+void UTICK_SetTick( UTICK_Type *base, utick_mode_t mode, uint32_t count, utick_callback_t cb )
+{
+	base->mode			= mode;
+	base->callback		= cb;
+	base->period_ns		= ((uint64_t)count + 1) * 1000ULL;
+	base->deadline_ns	= sim_time_ns + base->period_ns;
+	base->running		= (0 != count);
+}
+
+void OSTIMER_Init( OSTIMER_Type *base )
+{
+	base->running	= true;
+}
+
+void OSTIMER_Deinit( OSTIMER_Type *base )
+{
+	base->running	= false;
+}
+
+uint64_t OSTIMER_GetCurrentTimerValue( OSTIMER_Type * )
+{
+	return (sim_time_ns / 1000ULL) & ((1ULL << 42) - 1);
+}
+
+
+/*
+ *	LPI2C
+ */
+
+void LPI2C_MasterGetDefaultConfig( lpi2c_master_config_t *masterConfig )
+{
+	memset( masterConfig, 0, sizeof( lpi2c_master_config_t ) );
+
+	masterConfig->enableMaster	= true;
+	masterConfig->baudRate_Hz	= 100000U;
+}
+
+void LPI2C_MasterInit( LPI2C_Type *base, const lpi2c_master_config_t *masterConfig, uint32_t )
+{
+	base->MSR		= 0;
+	base->baudrate	= masterConfig->baudRate_Hz;
+	base->enabled	= masterConfig->enableMaster;
+	base->active	= false;
+	base->target	= NULL;
+}
+
+void LPI2C_MasterDeinit( LPI2C_Type *base )
+{
+	base->enabled	= false;
+}
+
+void LPI2C_MasterSetBaudRate( LPI2C_Type *base, uint32_t, uint32_t baudRate_Hz )
+{
+	base->baudrate	= baudRate_Hz;
+}
+
+uint32_t LPI2C_MasterGetStatusFlags( LPI2C_Type *base )
+{
+	return base->MSR;
+}
+
+void LPI2C_MasterClearStatusFlags( LPI2C_Type *base, uint32_t statusMask )
+{
+	base->MSR	&= ~statusMask;
+}
+
+void LPI2C_MasterGetFifoCounts( LPI2C_Type *, size_t *rxCount, size_t *txCount )
+{
+	if ( rxCount )
+		*rxCount	= 0;
+
+	if ( txCount )
+		*txCount	= 0;
+}
+
+status_t LPI2C_MasterStart( LPI2C_Type *base, uint8_t address, lpi2c_direction_t dir )
+{
+	SimDevice	*dev	= SimBus::find( base, address );
+	SimBusStats	&s		= bus_stats()[ base ];
+
+	if ( !base->active )
+		s.transactions++;
+
+	s.starts++;
+	s.bytes++;
+
+	base->MSR		&= ~kLPI2C_MasterNackDetectFlag;
+	base->active	= true;
+	base->target	= NULL;
+
+	if ( dev && dev->i2c_start( kLPI2C_Read == dir ) )
+		base->target	= dev;
+	else
+		base->MSR	|= kLPI2C_MasterNackDetectFlag;
+
+	bus_time( base, base->baudrate, 1 + 9 );
+
+	return kStatus_Success;
+}
+
+status_t LPI2C_MasterStop( LPI2C_Type *base )
+{
+	if ( base->active )
+	{
+		for ( auto& e : i2c_devices() )
+			if ( e.bus == base )
+				e.device->i2c_stop();
+
+		bus_time( base, base->baudrate, 1 );
+	}
+
+	base->active	= false;
+	base->target	= NULL;
+	base->MSR		|= kLPI2C_MasterStopDetectFlag;
+
+	return kStatus_Success;
+}
+
+status_t LPI2C_MasterSend( LPI2C_Type *base, void *txBuff, size_t txSize )
+{
+	SimDevice	*dev	= (SimDevice *)base->target;
+	uint8_t		*p		= (uint8_t *)txBuff;
+
+	if ( !dev )
+		return kStatus_LPI2C_Nak;
+
+	for ( size_t i = 0; i < txSize; i++ )
+	{
+		bus_stats()[ base ].bytes++;
+		bus_time( base, base->baudrate, 9 );
+
+		if ( !dev->i2c_write( p[ i ] ) )
+		{
+			base->MSR	|= kLPI2C_MasterNackDetectFlag;
+			return kStatus_LPI2C_Nak;
+		}
+	}
+
+	return kStatus_Success;
+}
+
+status_t LPI2C_MasterReceive( LPI2C_Type *base, void *rxBuff, size_t rxSize )
+{
+	SimDevice	*dev	= (SimDevice *)base->target;
+	uint8_t		*p		= (uint8_t *)rxBuff;
+
+	if ( !dev )
+		return kStatus_LPI2C_Nak;
+
+	for ( size_t i = 0; i < rxSize; i++ )
+		p[ i ]	= dev->i2c_read();
+
+	bus_stats()[ base ].bytes	+= rxSize;
+	bus_time( base, base->baudrate, 9 * rxSize );
+
+	return kStatus_Success;
+}
+
+static IRQn_Type lpi2c_irq( LPI2C_Type *base )
+{
+	return (IRQn_Type)(LPI2C0_IRQn + (base - host_lpi2c));
+}
+
+static status_t lpi2c_start_word( LPI2C_Type *base, uint8_t address, lpi2c_direction_t dir )
+{
+	LPI2C_MasterStart( base, address, dir );
+
+	return (base->MSR & kLPI2C_MasterNackDetectFlag) ? (status_t)kStatus_LPI2C_Nak : (status_t)kStatus_Success;
+}
+
+/*	a word for each of START, byte and STOP. Read data is stored into "rx"	*/
+static void lpi2c_words( LPI2C_Type *base, const lpi2c_master_transfer_t *transfer, uint8_t *rx, bus_job& j )
+{
+	uint8_t				address	= transfer->slaveAddress;
+	lpi2c_direction_t	dir		= transfer->direction;
+	uint8_t				*tx		= (uint8_t *)transfer->data;
+
+	bus_stats()[ base ].calls++;
+	j.words.clear();
+
+	if ( !(transfer->flags & kLPI2C_TransferNoStartFlag) )
+	{
+		if ( transfer->subaddressSize )
+		{
+			j.words.push_back( [ base, address ](){ return lpi2c_start_word( base, address, kLPI2C_Write ); } );
+
+			for ( size_t i = 0; i < transfer->subaddressSize; i++ )
+			{
+				uint8_t	sub	= (uint8_t)(transfer->subaddress >> (8 * (transfer->subaddressSize - 1 - i)));
+
+				j.words.push_back( [ base, sub ]() mutable { return LPI2C_MasterSend( base, &sub, 1 ); } );
+			}
+
+			if ( kLPI2C_Read == dir )
+				j.words.push_back( [ base, address ](){ return lpi2c_start_word( base, address, kLPI2C_Read ); } );
+		}
+		else
+		{
+			j.words.push_back( [ base, address, dir ](){ return lpi2c_start_word( base, address, dir ); } );
+		}
+	}
+
+	for ( size_t i = 0; i < transfer->dataSize; i++ )
+	{
+		if ( kLPI2C_Read == dir )
+			j.words.push_back( [ base, rx, i ](){ return LPI2C_MasterReceive( base, rx + i, 1 ); } );
+		else
+			j.words.push_back( [ base, tx, i ](){ return LPI2C_MasterSend( base, tx + i, 1 ); } );
+	}
+
+	if ( !(transfer->flags & kLPI2C_TransferNoStopFlag) )
+		j.words.push_back( [ base ](){ return LPI2C_MasterStop( base ); } );
+
+	j.abort	= [ base ](){ LPI2C_MasterStop( base ); };
+}
+
+status_t LPI2C_MasterTransferBlocking( LPI2C_Type *base, lpi2c_master_transfer_t *transfer )
+{
+	bus_job	j	= {};
+
+	lpi2c_words( base, transfer, (uint8_t *)transfer->data, j );
+
+	return job_exec( j, j.words.size() );
+}
+
+void LPI2C_MasterTransferCreateHandle( LPI2C_Type *base, lpi2c_master_handle_t *handle, lpi2c_master_transfer_callback_t callback, void *userData )
+{
+	memset( handle, 0, sizeof( lpi2c_master_handle_t ) );
+
+	handle->completionCallback	= callback;
+	handle->userData			= userData;
+
+	EnableIRQ( lpi2c_irq( base ) );
+}
+
+status_t LPI2C_MasterTransferNonBlocking( LPI2C_Type *base, lpi2c_master_handle_t *handle, lpi2c_master_transfer_t *transfer )
+{
+	bus_job&	j	= bus_jobs()[ lpi2c_irq( base ) ];
+
+	if ( j.active )
+		return kStatus_LPI2C_Busy;
+
+	handle->transfer	= *transfer;
+
+	bool	read	= kLPI2C_Read == transfer->direction;
+
+	j.rx.assign( read ? transfer->dataSize : 0, 0 );
+	lpi2c_words( base, &handle->transfer, j.rx.data(), j );
+
+	job_start( j, FSL_FEATURE_LPI2C_FIFO_SIZEn( base ), read ? (uint8_t *)transfer->data : NULL, [ base, handle ]( status_t r ){
+		if ( handle->completionCallback )
+			handle->completionCallback( base, handle, r, handle->userData );
+	} );
+
+	return kStatus_Success;
+}
+
+void LPI2C_MasterTransferAbort( LPI2C_Type *base, lpi2c_master_handle_t * )
+{
+	bus_job&	j	= bus_jobs()[ lpi2c_irq( base ) ];
+
+	if ( !j.active )
+		return;
+
+	j.active	= false;
+	j.pending	= false;
+
+	LPI2C_MasterStop( base );
+}
+
+
+/*
+ *	LPSPI
+ */
+
+void LPSPI_MasterGetDefaultConfig( lpspi_master_config_t *masterConfig )
+{
+	memset( masterConfig, 0, sizeof( lpspi_master_config_t ) );
+
+	masterConfig->baudRate		= 500000U;
+	masterConfig->bitsPerFrame	= 8U;
+	masterConfig->whichPcs		= kLPSPI_Pcs0;
+}
+
+void LPSPI_MasterInit( LPSPI_Type *base, const lpspi_master_config_t *masterConfig, uint32_t )
+{
+	base->baudrate			= masterConfig->baudRate;
+	base->TCR				= LPSPI_TCR_FRAMESZ( masterConfig->bitsPerFrame - 1 );
+	base->cpol				= masterConfig->cpol;
+	base->cpha				= masterConfig->cpha;
+	base->pcs_to_sck_ns		= masterConfig->pcsToSckDelayInNanoSec;
+	base->sck_to_pcs_ns		= masterConfig->lastSckToPcsDelayInNanoSec;
+	base->between_ns		= masterConfig->betweenTransferDelayInNanoSec;
+	base->enabled			= true;
+}
+
+void LPSPI_Deinit( LPSPI_Type *base )
+{
+	base->enabled	= false;
+}
+
+static void spi_hw_select( LPSPI_Type *base, bool select )
+{
+	bus_time( base, base->baudrate, 0, select ? base->pcs_to_sck_ns : base->sck_to_pcs_ns + base->between_ns );
+
+	base->pcs_asserted	= select;
+	spi_cs_update();
+}
+
+static uint8_t spi_exchange( LPSPI_Type *base, uint8_t data )
+{
+	uint8_t	r	= 0xFF;
+
+	for ( auto& e : spi_devices() )
+		if ( (e.bus == base) && e.selected )
+			r	&= e.device->spi_transfer( data );
+
+	return r;
+}
+
+static IRQn_Type lpspi_irq( LPSPI_Type *base )
+{
+	return (IRQn_Type)(LPSPI0_IRQn + (base - host_lpspi));
+}
+
+static size_t lpspi_frame_bytes( LPSPI_Type *base )
+{
+	return (((base->TCR & LPSPI_TCR_FRAMESZ_MASK) >> LPSPI_TCR_FRAMESZ_SHIFT) + 8) / 8;
+}
+
+static status_t lpspi_check( LPSPI_Type *base, const lpspi_transfer_t *transfer )
+{
+	if ( !base->enabled )
+		return kStatus_LPSPI_Error;
+
+	size_t	bpf	= lpspi_frame_bytes( base );
+
+	if ( !transfer->dataSize || (transfer->dataSize % bpf) )
+		return kStatus_InvalidArgument;
+
+	//	as SDK driver: frames over 4 bytes can be in a stream only if those are multiple of 4 bytes
+	if ( (4 < bpf) && (bpf % 4) && (transfer->dataSize != bpf) )
+		return kStatus_InvalidArgument;
+
+	return kStatus_Success;
+}
+
+/*	a word for each frame. Read data is stored into "rx"	*/
+static void lpspi_words( LPSPI_Type *base, const lpspi_transfer_t *transfer, uint8_t *rx, bus_job& j )
+{
+	size_t			bpf			= lpspi_frame_bytes( base );
+	size_t			size		= transfer->dataSize;
+	bool			continuous	= transfer->configFlags & kLPSPI_MasterPcsContinuous;
+	bool			swap		= transfer->configFlags & kLPSPI_MasterByteSwap;
+	const uint8_t	*tx			= transfer->txData;
+
+	bus_stats()[ base ].calls++;
+	j.words.clear();
+
+	for ( size_t f = 0; f < size; f += bpf )
+	{
+		bool	select		= !continuous || (0 == f);
+		bool	deselect	= !continuous || (size <= f + bpf);
+
+		j.words.push_back( [ = ](){
+			if ( select )
+				spi_hw_select( base, true );
+
+			for ( size_t k = 0; k < bpf; k++ )
+			{
+				size_t	i	= f + (swap ? k : (bpf - 1 - k));
+				uint8_t	d	= spi_exchange( base, tx ? tx[ i ] : 0x00 );
+
+				if ( rx )
+					rx[ i ]	= d;
+			}
+
+			bus_stats()[ base ].bytes	+= bpf;
+			bus_time( base, base->baudrate, 8 * bpf );
+
+			if ( deselect )
+				spi_hw_select( base, false );
+
+			return kStatus_Success;
+		} );
+	}
+
+	j.abort	= [ base ](){
+		if ( base->pcs_asserted )
+			spi_hw_select( base, false );
+	};
+}
+
+status_t LPSPI_MasterTransferBlocking( LPSPI_Type *base, lpspi_transfer_t *transfer )
+{
+	status_t	r;
+
+	if ( kStatus_Success != (r = lpspi_check( base, transfer )) )
+		return r;
+
+	bus_job	j	= {};
+
+	lpspi_words( base, transfer, transfer->rxData, j );
+
+	return job_exec( j, j.words.size() );
+}
+
+void LPSPI_MasterTransferCreateHandle( LPSPI_Type *base, lpspi_master_handle_t *handle, lpspi_master_transfer_callback_t callback, void *userData )
+{
+	memset( handle, 0, sizeof( lpspi_master_handle_t ) );
+
+	handle->callback	= callback;
+	handle->userData	= userData;
+
+	EnableIRQ( lpspi_irq( base ) );
+}
+
+status_t LPSPI_MasterTransferNonBlocking( LPSPI_Type *base, lpspi_master_handle_t *handle, lpspi_transfer_t *transfer )
+{
+	bus_job&	j	= bus_jobs()[ lpspi_irq( base ) ];
+	status_t	r;
+
+	if ( j.active )
+		return kStatus_LPSPI_Busy;
+
+	if ( kStatus_Success != (r = lpspi_check( base, transfer )) )
+		return r;
+
+	handle->transfer	= *transfer;
+
+	j.rx.assign( transfer->rxData ? transfer->dataSize : 0, 0 );
+	lpspi_words( base, &handle->transfer, transfer->rxData ? j.rx.data() : NULL, j );
+
+	job_start( j, FSL_FEATURE_LPSPI_FIFO_SIZEn( base ), transfer->rxData, [ base, handle ]( status_t r ){
+		if ( handle->callback )
+			handle->callback( base, handle, r, handle->userData );
+	} );
+
+	return kStatus_Success;
+}
+
+void LPSPI_MasterTransferAbort( LPSPI_Type *base, lpspi_master_handle_t * )
+{
+	bus_job&	j	= bus_jobs()[ lpspi_irq( base ) ];
+
+	if ( !j.active )
+		return;
+
+	j.active	= false;
+	j.pending	= false;
+
+	if ( j.abort )
+		j.abort();
+}
+
+
+/*
+ *	LPUART
+ */
+
+static bool lpuart_rx_empty( LPUART_Type *base )
+{
+	return base->rx_head == base->rx_tail;
+}
+
+void LPUART_GetDefaultConfig( lpuart_config_t *config )
+{
+	memset( config, 0, sizeof( lpuart_config_t ) );
+
+	config->baudRate_Bps	= 115200U;
+	config->parityMode		= kLPUART_ParityDisabled;
+	config->dataBitsCount	= kLPUART_EightDataBits;
+	config->stopBitCount	= kLPUART_OneStopBit;
+}
+
+status_t LPUART_Init( LPUART_Type *base, const lpuart_config_t *config, uint32_t )
+{
+	base->baudrate		= config->baudRate_Bps;
+	base->tx_enabled	= config->enableTx;
+	base->rx_enabled	= config->enableRx;
+	base->CTRL			= 0;
+	base->STAT			= 0;
+	base->rx_head		= 0;
+	base->rx_tail		= 0;
+	base->FIFO			= 0;
+	base->tx_water		= config->txFifoWatermark;
+	base->rx_water		= config->rxFifoWatermark;
+	base->tx_count		= 0;
+	base->rx_idle		= false;
+
+	return kStatus_Success;
+}
+
+void LPUART_Deinit( LPUART_Type *base )
+{
+	base->tx_enabled	= false;
+	base->rx_enabled	= false;
+	base->CTRL			= 0;
+}
+
+void LPUART_EnableInterrupts( LPUART_Type *base, uint32_t mask )
+{
+	base->CTRL	|= mask;
+	irq_service();
+}
+
+void LPUART_DisableInterrupts( LPUART_Type *base, uint32_t mask )
+{
+	base->CTRL	&= ~mask;
+}
+
+uint32_t LPUART_GetEnabledInterrupts( LPUART_Type *base )
+{
+	return base->CTRL;
+}
+
+uint32_t LPUART_GetStatusFlags( LPUART_Type *base )
+{
+	uint32_t	flags	= base->STAT;
+	uint32_t	rx		= LPUART_GetRxFifoCount( base );
+
+	if ( base->tx_count <= base->tx_water )
+		flags	|= kLPUART_TxDataRegEmptyFlag;
+
+	if ( !base->tx_count )
+		flags	|= kLPUART_TransmissionCompleteFlag;
+
+	if ( (rx > base->rx_water) || (rx && base->rx_idle && (base->FIFO & LPUART_FIFO_RXIDEN_MASK)) )
+		flags	|= kLPUART_RxDataRegFullFlag;
+
+	return flags;
+}
+
+uint32_t LPUART_GetTxFifoCount( LPUART_Type *base )
+{
+	return base->tx_count;
+}
+
+uint32_t LPUART_GetRxFifoCount( LPUART_Type *base )
+{
+	return (base->rx_head - base->rx_tail + HOST_LPUART_RX_BUF_SIZE) % HOST_LPUART_RX_BUF_SIZE;
+}
+
+status_t LPUART_ClearStatusFlags( LPUART_Type *base, uint32_t mask )
+{
+	base->STAT	&= ~mask;
+
+	return kStatus_Success;
+}
+
+void LPUART_WriteByte( LPUART_Type *base, uint8_t data )
+{
+	if ( !base->tx_enabled )
+		return;
+
+	if ( base->tx_count < FSL_FEATURE_LPUART_FIFO_SIZEn( base ) )
+		base->tx_count++;
+
+	auto	s	= uart_sinks().find( base );
+
+	if ( (s != uart_sinks().end()) && s->second )
+		s->second( data );
+	else
+		fputc( data, stdout );
+}
+
+uint8_t LPUART_ReadByte( LPUART_Type *base )
+{
+	if ( lpuart_rx_empty( base ) )
+		return 0;
+
+	uint8_t	data	= base->rx_buf[ base->rx_tail ];
+	base->rx_tail	= (base->rx_tail + 1) % HOST_LPUART_RX_BUF_SIZE;
+
+	return data;
+}
+
+status_t LPUART_WriteBlocking( LPUART_Type *base, const uint8_t *data, size_t length )
+{
+	for ( size_t i = 0; i < length; i++ )
+	{
+		LPUART_WriteByte( base, data[ i ] );
+		base->tx_count	= 0;
+	}
+
+	return kStatus_Success;
+}
+
+status_t LPUART_ReadBlocking( LPUART_Type *base, uint8_t *data, size_t length )
+{
+	for ( size_t i = 0; i < length; i++ )
+	{
+		if ( lpuart_rx_empty( base ) )
+			return kStatus_LPUART_Timeout;
+
+		data[ i ]	= LPUART_ReadByte( base );
+	}
+
+	return kStatus_Success;
+}
+
+}	// extern "C"
+
+
+/*
+ *	SimDevice
+ */
+
+SimDevice::SimDevice() {}
+
+SimDevice::~SimDevice()
+{
+	SimBus::detach( this );
+}
+
+bool	SimDevice::i2c_start( bool )		{ return true; }
+bool	SimDevice::i2c_write( uint8_t )	{ return true; }
+uint8_t	SimDevice::i2c_read( void )				{ return 0xFF; }
+void	SimDevice::i2c_stop( void )				{}
+void	SimDevice::spi_select( bool )	{}
+uint8_t	SimDevice::spi_transfer( uint8_t )	{ return 0xFF; }
+
+
+/*
+ *	SimRegisterDevice
+ */
+
+SimRegisterDevice::SimRegisterDevice( uint8_t ai_flag, uint8_t pointer_mask )
+	: regs{ 0 }, pointer( 0 ), _ai_flag( ai_flag ), _mask( pointer_mask ), _first( false ), _ai( true )
+{
+}
+
+SimRegisterDevice::~SimRegisterDevice()
+{
+}
+
+bool SimRegisterDevice::i2c_start( bool read )
+{
+	_first	= !read;
+	return true;
+}
+
+bool SimRegisterDevice::i2c_write( uint8_t data )
+{
+	if ( _first )
+	{
+		_ai		= _ai_flag ? (data & _ai_flag) : true;
+		pointer	= (data & ~_ai_flag) & _mask;
+		_first	= false;
+	}
+	else
+	{
+		reg_write( pointer, data );
+		increment();
+	}
+
+	return true;
+}
+
+uint8_t SimRegisterDevice::i2c_read( void )
+{
+	uint8_t	v	= reg_read( pointer );
+
+	increment();
+	return v;
+}
+
+uint8_t SimRegisterDevice::reg_read( uint8_t reg )
+{
+	return regs[ reg ];
+}
+
+void SimRegisterDevice::reg_write( uint8_t reg, uint8_t value )
+{
+	regs[ reg ]	= value;
+}
+
+void SimRegisterDevice::increment( void )
+{
+	if ( _ai )
+		pointer	= (pointer + 1) & _mask;
+}
+
+
+/*
+ *	SimBus
+ */
+
+void SimBus::attach( LPI2C_Type *bus, uint8_t address, SimDevice *device )
+{
+	i2c_devices().push_back( { bus, address, device } );
+}
+
+void SimBus::attach( LPSPI_Type *bus, int cs_pin, SimDevice *device )
+{
+	spi_devices().push_back( { bus, cs_pin, device, false } );
+	spi_cs_update();
+}
+
+void SimBus::detach( SimDevice *device )
+{
+	auto&	i2c	= i2c_devices();
+	auto&	spi	= spi_devices();
+
+	for ( auto it = i2c.begin(); it != i2c.end(); )
+		it	= (it->device == device) ? i2c.erase( it ) : it + 1;
+
+	for ( auto it = spi.begin(); it != spi.end(); )
+		it	= (it->device == device) ? spi.erase( it ) : it + 1;
+
+	for ( auto& b : host_lpi2c )
+		if ( b.target == device )
+			b.target	= NULL;
+}
+
+SimDevice* SimBus::find( LPI2C_Type *bus, uint8_t address )
+{
+	for ( auto& e : i2c_devices() )
+		if ( (e.bus == bus) && (e.address == address) )
+			return e.device;
+
+	return nullptr;
+}
+
+
+SimBusStats SimBus::stats( LPI2C_Type *bus )
+{
+	return bus_stats()[ bus ];
+}
+
+SimBusStats SimBus::stats( LPSPI_Type *bus )
+{
+	return bus_stats()[ bus ];
+}
+
+SimBusStats SimBus::total( void )
+{
+	SimBusStats	t	= {};
+
+	for ( auto& e : bus_stats() )
+		t	+= e.second;
+
+	return t;
+}
+
+void SimBus::reset_stats( void )
+{
+	bus_stats().clear();
+}
+
+SimBusStats& SimBusStats::operator+=( const SimBusStats& rhs )
+{
+	transactions	+= rhs.transactions;
+	starts			+= rhs.starts;
+	bytes			+= rhs.bytes;
+	bits			+= rhs.bits;
+	time_ns			+= rhs.time_ns;
+	calls			+= rhs.calls;
+
+	return *this;
+}
+
+SimBusStats SimBusStats::operator-( const SimBusStats& rhs ) const
+{
+	SimBusStats	d;
+
+	d.transactions	= transactions	- rhs.transactions;
+	d.starts		= starts		- rhs.starts;
+	d.bytes			= bytes			- rhs.bytes;
+	d.bits			= bits			- rhs.bits;
+	d.time_ns		= time_ns		- rhs.time_ns;
+	d.calls			= calls			- rhs.calls;
+
+	return d;
+}
+
+
+/*
+ *	SimGPIO
+ */
+
+void SimGPIO::input( int pin, bool level )
+{
+	int	port, bit;
+
+	if ( !pin_decode( pin, port, bit ) )
+		return;
+
+	GPIO_Type	*g		= &host_gpio[ port ];
+	uint32_t	mask	= 1UL << bit;
+	bool		prev	= g->PDIR & mask;
+
+	if ( level )
+		g->PDIR	|= mask;
+	else
+		g->PDIR	&= ~mask;
+
+	bool	rise	= !prev &&  level;
+	bool	fall	=  prev && !level;
+	bool	event	= false;
+
+	switch ( g->ICR[ bit ] )
+	{
+		case kGPIO_InterruptRisingEdge:		event	= rise;				break;
+		case kGPIO_InterruptFallingEdge:	event	= fall;				break;
+		case kGPIO_InterruptEitherEdge:		event	= rise || fall;		break;
+		case kGPIO_InterruptLogicZero:		event	= !level;			break;
+		case kGPIO_InterruptLogicOne:		event	= level;			break;
+		default:														break;
+	}
+
+	if ( event )
+	{
+		g->ISFR	|= mask;
+		irq_service();
+	}
+}
+
+bool SimGPIO::output( int pin )
+{
+	int	port, bit;
+
+	if ( !pin_decode( pin, port, bit ) )
+		return false;
+
+	return host_gpio[ port ].PDOR & (1UL << bit);
+}
+
+void SimGPIO::watch( int pin, watch_cb_t callback )
+{
+	if ( callback )
+		pin_watchers()[ pin ]	= callback;
+	else
+		pin_watchers().erase( pin );
+}
+
+
+/*
+ *	SimUART
+ */
+
+void SimUART::input( LPUART_Type *uart, const uint8_t *data, size_t length, bool idle )
+{
+	if ( length )
+		uart->rx_idle	= false;
+
+	for ( size_t i = 0; i < length; i++ )
+	{
+		uint16_t	next	= (uart->rx_head + 1) % HOST_LPUART_RX_BUF_SIZE;
+
+		if ( !uart->rx_enabled )
+			break;
+
+		if ( next == uart->rx_tail )
+		{
+			uart->STAT	|= kLPUART_RxOverrunFlag;
+			continue;
+		}
+
+		uart->rx_buf[ uart->rx_head ]	= data[ i ];
+		uart->rx_head	= next;
+	}
+
+	//	line goes idle after the data
+	if ( idle && length && uart->rx_enabled )
+	{
+		uart->STAT		|= kLPUART_IdleLineFlag;
+		uart->rx_idle	= true;
+	}
+
+	irq_service();
+}
+
+void SimUART::sink( LPUART_Type *uart, sink_cb_t callback )
+{
+	uart_sinks()[ uart ]	= callback;
+}
+
+
+/*
+ *	SimClock
+ */
+
+uint64_t SimClock::now_ns( void )
+{
+	return sim_time_ns;
+}
+
+uint64_t SimClock::now_us( void )
+{
+	return sim_time_ns / 1000ULL;
+}
+
+uint64_t SimClock::core_ns( void )
+{
+	return sim_time_ns - sleep_ns;
+}
+
+void SimClock::advance_ns( uint64_t ns )
+{
+	uint64_t	target	= sim_time_ns + ns;
+	UTICK_Type	*t		= UTICK0;
+	uint64_t	e;
+
+	while ( (e = next_event_ns()) <= target )
+	{
+		if ( sim_time_ns < e )
+			sim_time_ns	= e;
+
+		if ( t->running && (t->deadline_ns <= sim_time_ns) )
+		{
+			if ( kUTICK_Repeat == t->mode )
+				t->deadline_ns	+= t->period_ns;
+			else
+				t->running		= false;
+
+			utick_pending	= true;
+		}
+
+		for ( auto& j : bus_jobs() )
+			if ( j.second.active && (j.second.deadline_ns <= sim_time_ns) )
+				j.second.pending	= true;
+
+		irq_service();
+	}
+
+	if ( sim_time_ns < target )
+		sim_time_ns	= target;
+}
+
+
+/*
+ *	SimIRQ
+ */
+
+uint32_t SimIRQ::count( IRQn_Type irq )
+{
+	return irq_count[ irq ];
+}
+
+uint32_t SimIRQ::total( void )
+{
+	uint32_t	sum	= 0;
+
+	for ( auto c : irq_count )
+		sum	+= c;
+
+	return sum;
+}
+
+void SimIRQ::reset( void )
+{
+	memset( irq_count, 0, sizeof( irq_count ) );
+}
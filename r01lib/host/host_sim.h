@@ -0,0 +1,329 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/** Simulation environment for host (CPU_HOST) build
+ *
+ *	On host, r01lib runs with simulated buses, pins and time.
+ *	Device models are derived from SimDevice and registered to a bus by SimBus::attach().
+ *	The time is simulated. It advances by wait() and callbacks of Ticker are called in it.
+ *	Bus transfers take the time of bits on the bus at the configured frequency.
+ */
+
+#ifndef R01LIB_HOST_SIM_H
+#define R01LIB_HOST_SIM_H
+
+#include	<stdint.h>
+#include	<functional>
+
+#include	"fsl_lpi2c.h"
+#include	"fsl_lpspi.h"
+#include	"fsl_lpuart.h"
+
+/** SimDevice class
+ *
+ *  @class SimDevice
+ *
+ *	A base class for device models on simulated buses.
+ *	Override methods for the interface of the device.
+ */
+class SimDevice
+{
+public:
+	SimDevice();
+
+	/** Destructor, the device is detached from all buses */
+	virtual ~SimDevice();
+
+	/** I2C: START or repeated-START with matched address
+	 *
+	 * @param read true if read transaction
+	 * @return true to ACK
+	 */
+	virtual bool	i2c_start( bool read );
+
+	/** I2C: data byte from controller
+	 *
+	 * @param data received byte
+	 * @return true to ACK
+	 */
+	virtual bool	i2c_write( uint8_t data );
+
+	/** I2C: data byte to controller
+	 *
+	 * @return byte to send
+	 */
+	virtual uint8_t	i2c_read( void );
+
+	/** I2C: STOP condition on the bus */
+	virtual void	i2c_stop( void );
+
+	/** SPI: chip-select state change
+	 *
+	 * @param selected true when chip-select is asserted
+	 */
+	virtual void	spi_select( bool selected );
+
+	/** SPI: a byte exchange while chip-select is asserted
+	 *
+	 * @param data byte on MOSI
+	 * @return byte on MISO
+	 */
+	virtual uint8_t	spi_transfer( uint8_t data );
+};
+
+/** SimRegisterDevice class
+ *
+ *  @class SimRegisterDevice
+ *
+ *	A model of generic I2C device which has 8 bit register pointer and registers.
+ *	First byte of write transaction sets the register pointer and the pointer is incremented on each data byte.
+ *	Override reg_read()/reg_write() to model the device behavior.
+ */
+class SimRegisterDevice : public SimDevice
+{
+public:
+	/** Create a SimRegisterDevice instance
+	 *
+	 * @param ai_flag (option) bit in register pointer which is auto-increment flag. The bit is ignored as address
+	 * @param pointer_mask (option) mask for register pointer wrap-around
+	 */
+	SimRegisterDevice( uint8_t ai_flag = 0x00, uint8_t pointer_mask = 0xFF );
+	virtual ~SimRegisterDevice();
+
+	virtual bool	i2c_start( bool read );
+	virtual bool	i2c_write( uint8_t data );
+	virtual uint8_t	i2c_read( void );
+
+	/** Register read, called for each byte to controller
+	 *
+	 * @param reg register address
+	 * @return register value
+	 */
+	virtual uint8_t	reg_read( uint8_t reg );
+
+	/** Register write, called for each data byte from controller
+	 *
+	 * @param reg register address
+	 * @param value value to write
+	 */
+	virtual void	reg_write( uint8_t reg, uint8_t value );
+
+	/** register content */
+	uint8_t			regs[ 256 ];
+
+protected:
+	uint8_t			pointer;
+
+private:
+	void			increment( void );
+
+	uint8_t			_ai_flag;
+	uint8_t			_mask;
+	bool			_first;
+	bool			_ai;
+};
+
+/** Bus activity counters  */
+struct SimBusStats
+{
+	uint32_t	transactions;	/**< I2C: START to STOP, SPI: chip-select assertions to attached devices */
+	uint32_t	starts;			/**< I2C START and repeated-START conditions */
+	uint32_t	bytes;			/**< bytes on the bus, I2C address bytes included */
+	uint64_t	bits;			/**< bit-times on the bus, I2C START/STOP and ACK included */
+	uint64_t	time_ns;		/**< bus time at the configured frequency */
+	uint32_t	calls;			/**< transfer calls to LPI2C/LPSPI driver. fewer calls, less CPU intervention */
+
+	SimBusStats&	operator+=( const SimBusStats& rhs );
+	SimBusStats		operator-( const SimBusStats& rhs ) const;
+};
+
+/** SimBus class
+ *
+ *  @class SimBus
+ *
+ *	Device model registry for simulated I2C and SPI buses
+ */
+class SimBus
+{
+public:
+	/** Register I2C device model
+	 *
+	 * @param bus I2C peripheral (LPI2C0 or LPI2C1)
+	 * @param address 7 bit target address
+	 * @param device device model
+	 */
+	static void			attach( LPI2C_Type *bus, uint8_t address, SimDevice *device );
+
+	/** Register SPI device model
+	 *
+	 * @param bus SPI peripheral (LPSPI0 or LPSPI1)
+	 * @param cs_pin pin number of chip-select which the device connected
+	 * @param device device model
+	 */
+	static void			attach( LPSPI_Type *bus, int cs_pin, SimDevice *device );
+
+	/** Remove the device model from all buses
+	 *
+	 * @param device device model
+	 */
+	static void			detach( SimDevice *device );
+
+	/** Find I2C device model
+	 *
+	 * @param bus I2C peripheral
+	 * @param address 7 bit target address
+	 * @return device model, nullptr if not registered
+	 */
+	static SimDevice*	find( LPI2C_Type *bus, uint8_t address );
+
+	/** Bus activity counters
+	 *
+	 * @param bus I2C peripheral
+	 * @return counters since start or last reset_stats()
+	 */
+	static SimBusStats	stats( LPI2C_Type *bus );
+
+	/** Bus activity counters
+	 *
+	 * @param bus SPI peripheral
+	 * @return counters since start or last reset_stats()
+	 */
+	static SimBusStats	stats( LPSPI_Type *bus );
+
+	/** Bus activity counters of all buses
+	 *
+	 * @return sum of counters
+	 */
+	static SimBusStats	total( void );
+
+	/** Clear counters of all buses */
+	static void			reset_stats( void );
+};
+
+/** SimGPIO class
+ *
+ *  @class SimGPIO
+ *
+ *	Access to simulated pins from outside of MCU
+ */
+class SimGPIO
+{
+public:
+	using watch_cb_t	= std::function<void( bool level )>;
+
+	/** Drive an input pin. Edge on the pin generates interrupt if it is enabled by InterruptIn
+	 *
+	 * @param pin pin number
+	 * @param level pin level
+	 */
+	static void		input( int pin, bool level );
+
+	/** Output level of the pin
+	 *
+	 * @param pin pin number
+	 * @return output level
+	 */
+	static bool		output( int pin );
+
+	/** Register callback which is called when the output level of the pin changed
+	 *
+	 * @param pin pin number
+	 * @param callback callback function, nullptr to remove
+	 */
+	static void		watch( int pin, watch_cb_t callback );
+};
+
+/** SimUART class
+ *
+ *  @class SimUART
+ *
+ *	Access to simulated UART lines from outside of MCU
+ */
+class SimUART
+{
+public:
+	using sink_cb_t	= std::function<void( uint8_t data )>;
+
+	/** Give received data to UART
+	 *
+	 * @param uart UART peripheral (LPUART0 or LPUART1)
+	 * @param data data
+	 * @param length data length
+	 * @param idle (option) the line becomes idle after the data. "false" to give more data in the same frame
+	 */
+	static void		input( LPUART_Type *uart, const uint8_t *data, size_t length, bool idle = true );
+
+	/** Set destination of transmitted data. Default is stdout
+	 *
+	 * @param uart UART peripheral (LPUART0 or LPUART1)
+	 * @param callback callback for each transmitted byte, nullptr to set default
+	 */
+	static void		sink( LPUART_Type *uart, sink_cb_t callback );
+};
+
+/** SimIRQ class
+ *
+ *  @class SimIRQ
+ *
+ *	Interrupt counters. A handler call is counted as an interrupt
+ */
+class SimIRQ
+{
+public:
+	/** Number of interrupts
+	 *
+	 * @param irq interrupt number
+	 * @return count since start or last reset()
+	 */
+	static uint32_t	count( IRQn_Type irq );
+
+	/** Number of interrupts of all sources
+	 *
+	 * @return count since start or last reset()
+	 */
+	static uint32_t	total( void );
+
+	/** Clear counters */
+	static void		reset( void );
+};
+
+/** SimClock class
+ *
+ *  @class SimClock
+ *
+ *	Simulated time
+ */
+class SimClock
+{
+public:
+	/** Current time
+	 *
+	 * @return time in nano-seconds from start
+	 */
+	static uint64_t	now_ns( void );
+
+	/** Current time
+	 *
+	 * @return time in micro-seconds from start
+	 */
+	static uint64_t	now_us( void );
+
+	/** Time the core has been running
+	 *
+	 *	Time in __WFI() is not included as the core clock (and DWT cycle counter) is stopped in sleep
+	 *
+	 * @return time in nano-seconds from start
+	 */
+	static uint64_t	core_ns( void );
+
+	/** Advance the time. Timer callbacks are called if those are due
+	 *
+	 * @param ns time to advance in nano-seconds
+	 */
+	static void		advance_ns( uint64_t ns );
+};
+
+#endif // R01LIB_HOST_SIM_H
@@ -0,0 +1,25 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/*
+ *	Host (CPU_HOST) replacement of MCUXpresso board files
+ */
+
+#ifndef R01LIB_HOST_PIN_MUX_H
+#define R01LIB_HOST_PIN_MUX_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void	BOARD_InitBootPins( void );
+void	BOARD_InitPins( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // R01LIB_HOST_PIN_MUX_H
@@ -0,0 +1,156 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+#include	<stdlib.h>
+#include	<string.h>
+#include	<map>
+
+#include	"sim_bench.h"
+
+static std::vector<SimBench::record>&			records( void )	{ static std::vector<SimBench::record>	v; return v; }
+static std::map<std::string, std::pair<uint32_t, uint32_t>>&	limits( void )	{ static std::map<std::string, std::pair<uint32_t, uint32_t>>	m; return m; }
+
+static bool exceeded( const SimBench::record& r )
+{
+	return ((r.limit      != SimBench::NO_LIMIT) && (r.limit      < r.bus.transactions))
+		|| ((r.call_limit != SimBench::NO_LIMIT) && (r.call_limit < r.bus.calls));
+}
+
+SimBench::record SimBench::run( const char *name, std::function<void( void )> func )
+{
+	SimBusStats	bus		= SimBus::total();
+	uint64_t	time	= SimClock::now_ns();
+	uint32_t	irqs	= SimIRQ::total();
+
+	func();
+
+	record	r;
+
+	r.name			= name;
+	r.bus			= SimBus::total() - bus;
+	r.elapsed_ns	= SimClock::now_ns() - time;
+	r.irqs			= SimIRQ::total() - irqs;
+
+	auto	l		= limits().find( r.name );
+	r.limit			= (l != limits().end()) ? l->second.first  : NO_LIMIT;
+	r.call_limit	= (l != limits().end()) ? l->second.second : NO_LIMIT;
+
+	records().push_back( r );
+
+	return records().back();
+}
+
+void SimBench::limit( const char *name, uint32_t transactions, uint32_t calls )
+{
+	limits()[ name ]	= { transactions, calls };
+
+	for ( auto& r : records() )
+		if ( r.name == name )
+		{
+			r.limit			= transactions;
+			r.call_limit	= calls;
+		}
+}
+
+int SimBench::load_baseline( const char *path )
+{
+	FILE	*fp		= fopen( path, "r" );
+	char	line[ 256 ];
+	int		count	= 0;
+
+	if ( !fp )
+		return -1;
+
+	while ( fgets( line, sizeof( line ), fp ) )
+	{
+		char	*tab	= strchr( line, '\t' );
+		char	*end;
+
+		if ( !tab )
+			continue;
+
+		*tab	= '\0';
+
+		uint32_t	transactions	= (uint32_t)strtoul( tab + 1, &end, 10 );
+		uint32_t	calls			= ('\t' == *end) ? (uint32_t)strtoul( end + 1, NULL, 10 ) : NO_LIMIT;
+
+		limit( line, transactions, calls );
+		count++;
+	}
+
+	fclose( fp );
+
+	return count;
+}
+
+int SimBench::save_baseline( const char *path )
+{
+	FILE	*fp		= fopen( path, "w" );
+	int		count	= 0;
+
+	if ( !fp )
+		return -1;
+
+	for ( auto& r : records() )
+	{
+		fprintf( fp, "%s\t%lu\t%lu\n", r.name.c_str(), (unsigned long)r.bus.transactions, (unsigned long)r.bus.calls );
+		count++;
+	}
+
+	fclose( fp );
+
+	return count;
+}
+
+void SimBench::report( FILE *fp )
+{
+	fprintf( fp, "%-40s %8s %8s %8s %8s %12s %12s %8s %8s %8s\n", "API", "trans", "calls", "starts", "bytes", "bus[us]", "elapsed[us]", "irqs", "limit", "c-limit" );
+
+	for ( auto& r : records() )
+	{
+		fprintf( fp, "%-40s %8lu %8lu %8lu %8lu %12.1f %12.1f %8lu ",
+				r.name.c_str(),
+				(unsigned long)r.bus.transactions,
+				(unsigned long)r.bus.calls,
+				(unsigned long)r.bus.starts,
+				(unsigned long)r.bus.bytes,
+				r.bus.time_ns / 1000.0,
+				r.elapsed_ns / 1000.0,
+				(unsigned long)r.irqs
+		);
+
+		if ( r.limit != NO_LIMIT )
+			fprintf( fp, "%8lu ", (unsigned long)r.limit );
+		else
+			fprintf( fp, "%8s ", "-" );
+
+		if ( r.call_limit != NO_LIMIT )
+			fprintf( fp, "%8lu", (unsigned long)r.call_limit );
+		else
+			fprintf( fp, "%8s", "-" );
+
+		fprintf( fp, "%s\n", exceeded( r ) ? "  << FAIL" : "" );
+	}
+
+	fprintf( fp, "%d failure(s)\n", failures() );
+}
+
+int SimBench::failures( void )
+{
+	int	count	= 0;
+
+	for ( auto& r : records() )
+		if ( exceeded( r ) )
+			count++;
+
+	return count;
+}
+
+void SimBench::clear( void )
+{
+	records().clear();
+	limits().clear();
+}
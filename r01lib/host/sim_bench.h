@@ -0,0 +1,98 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/** Benchmark for driver APIs on host (CPU_HOST) build
+ *
+ *	Measures bus activity and time of API calls on simulated buses.
+ *	Number of transactions can be limited by baseline to find regressions.
+ *
+ *	Example:
+ *	@code
+ *	SimBench::load_baseline( "bench_baseline.txt" );
+ *	SimBench::run( "PCA995x::pwm(float*)", [&]{ led.pwm( values ); } );
+ *	SimBench::report();
+ *	return SimBench::failures();
+ *	@endcode
+ */
+
+#ifndef R01LIB_HOST_SIM_BENCH_H
+#define R01LIB_HOST_SIM_BENCH_H
+
+#include	<stdio.h>
+#include	<string>
+#include	<vector>
+#include	<functional>
+
+#include	"host_sim.h"
+
+/** SimBench class
+ *
+ *  @class SimBench
+ */
+class SimBench
+{
+public:
+	/** Result of a measurement */
+	struct record
+	{
+		std::string	name;
+		SimBusStats	bus;			/**< activity on all buses while the API call */
+		uint64_t	elapsed_ns;		/**< simulated time including waits in the call */
+		uint32_t	irqs;			/**< interrupts while the API call */
+		uint32_t	limit;			/**< limit of transactions, NO_LIMIT if not given */
+		uint32_t	call_limit;		/**< limit of driver transfer calls, NO_LIMIT if not given */
+	};
+
+	/** Limit value for measurements without limit */
+	static constexpr uint32_t	NO_LIMIT	= UINT32_MAX;
+
+	/** Run and measure an API call
+	 *
+	 * @param name name of the measurement
+	 * @param func function to call
+	 * @return result
+	 */
+	static record			run( const char *name, std::function<void( void )> func );
+
+	/** Set limit of transactions for a measurement
+	 *
+	 * @param name name of the measurement
+	 * @param transactions maximum number of transactions
+	 * @param calls (option) maximum number of driver transfer calls
+	 */
+	static void				limit( const char *name, uint32_t transactions, uint32_t calls = NO_LIMIT );
+
+	/** Set limits from baseline file. Each line is "name<TAB>transactions" or "name<TAB>transactions<TAB>calls"
+	 *
+	 * @param path file path
+	 * @return number of limits read, -1 if the file cannot be opened
+	 */
+	static int				load_baseline( const char *path );
+
+	/** Save transactions and driver transfer calls of all measurements as baseline file
+	 *
+	 * @param path file path
+	 * @return number of lines written, -1 if the file cannot be opened
+	 */
+	static int				save_baseline( const char *path );
+
+	/** Print results
+	 *
+	 * @param fp output stream
+	 */
+	static void				report( FILE *fp = stdout );
+
+	/** Number of measurements which exceeded its limit
+	 *
+	 * @return number of failures
+	 */
+	static int				failures( void );
+
+	/** Clear results and limits */
+	static void				clear( void );
+};
+
+#endif // R01LIB_HOST_SIM_BENCH_H
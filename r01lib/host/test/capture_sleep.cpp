@@ -0,0 +1,113 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/** Test of InterruptIn capture with a sleeping main loop on host (CPU_HOST) build
+ *
+ *	A 1 kHz, 25% duty signal is made by a Ticker on a pin while the main loop sleeps by WFI. 
+ *	Captured edges, period(), pulse_width(), duty() and frequency() are checked. 
+ *	Time in sleep is not counted by cycle_count() (as DWT on hardware), so this fails with a timebase which stops in sleep.
+ *	Then the destructor is checked: it disarms capture mode only, and callbacks by rise()/fall() are kept.
+ *	Exit code is 0 if all checks passed.
+ *
+ *	Build as "Host build" in README.md with this file as the application.
+ */
+
+#include	<math.h>
+
+#include	"r01lib.h"
+#include	"host_sim.h"
+
+static int	failures	= 0;
+static int	phase		= 0;
+static int	rises		= 0;
+
+static void check( const char *name, bool result )
+{
+	printf( "%-40s %s\n", name, result ? "ok" : "FAIL" );
+
+	if ( !result )
+		failures++;
+}
+
+static bool near( float v, float expected, float tolerance )
+{
+	return fabsf( v - expected ) <= tolerance;
+}
+
+//	1 kHz: high for 250 us, low for 750 us
+static void signal( void )
+{
+	if ( 0 == phase )
+		SimGPIO::input( D2, 1 );
+	else if ( 1 == phase )
+		SimGPIO::input( D2, 0 );
+
+	phase	= (phase + 1) % 4;
+}
+
+static void on_rise( void )
+{
+	rises++;
+}
+
+int main( void )
+{
+	SimGPIO::input( D2, 0 );
+
+	InterruptIn	*in	= new InterruptIn( D2 );
+	Ticker		generator;
+
+	in->capture_start( 64 );
+	in->frequency();
+	generator.attach_us( signal, 250 );
+
+	while ( in->capture_available() < 40 )
+		__WFI();
+
+	generator.detach();
+
+	InterruptIn::edge	e;
+	InterruptIn::edge	prev;
+	int					n		= 0;
+	bool				ok		= true;
+
+	while ( in->capture_read( e ) )
+	{
+		if ( n )
+			ok	= ok && (e.rising != prev.rising) && near( e.time - prev.time, prev.rising ? 250 : 750, 1 );
+
+		prev	= e;
+		n++;
+	}
+
+	check( "edges captured while sleeping",			40 == n );
+	check( "edge intervals",						ok );
+	check( "period()",								near( in->period(),      1e-3,   2e-6 ) );
+	check( "pulse_width()",							near( in->pulse_width(), 250e-6, 2e-6 ) );
+	check( "duty()",								near( in->duty(),        0.25,   0.01 ) );
+	check( "frequency()",							near( in->frequency(),   1000.0, 5.0 ) );
+	check( "no overrun",							!in->capture_overruns() );
+
+	//	destructor in capture mode disarms the pin: an edge after that must not reach the deleted instance
+	delete in;
+
+	uint32_t	irqs	= SimIRQ::total();
+
+	SimGPIO::input( D2, 1 );
+	SimGPIO::input( D2, 0 );
+	check( "capture disarmed by destructor",		irqs == SimIRQ::total() );
+
+	//	plain callback stays after the instance is gone
+	InterruptIn	*button	= new InterruptIn( D2 );
+
+	button->rise( on_rise );
+	delete button;
+	SimGPIO::input( D2, 1 );
+	SimGPIO::input( D2, 0 );
+	check( "rise() callback kept by destructor",	1 == rises );
+
+	return failures;
+}
@@ -0,0 +1,116 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/** Loopback test of SerialFramer and FrameCodec on host (CPU_HOST) build
+ *
+ *	TX of the Serial is looped back to its RX. Random records (including zero-filled and maximum length ones) 
+ *	are sent and compared with received ones. Then a corrupted frame is given to the decoder to check error counting.
+ *	Exit code is 0 if all checks passed.
+ *
+ *	Bytes on the wire are saved to a file if a path is given, to be checked with tools/frame_decode.
+ *	@code
+ *	./framer_loopback capture.bin && ./frame_decode capture.bin
+ *	@endcode
+ *
+ *	Build as "Host build" in README.md with this file as the application.
+ */
+
+#include	<stdlib.h>
+#include	<vector>
+
+#include	"r01lib.h"
+#include	"SerialFramer.h"
+#include	"host_sim.h"
+
+static FILE	*capture	= nullptr;
+static int	failures	= 0;
+
+static void check( const char *name, bool result )
+{
+	printf( "%-40s %s\n", name, result ? "ok" : "FAIL" );
+
+	if ( !result )
+		failures++;
+}
+
+int main( int argc, char *argv[] )
+{
+	using record	= std::vector<uint8_t>;
+
+	if ( (1 < argc) && !(capture = fopen( argv[ 1 ], "wb" )) )
+	{
+		fprintf( stderr, "cannot open %s\n", argv[ 1 ] );
+		return -1;
+	}
+
+	Serial			serial( MB_TX, MB_RX, 921600 );
+	SerialFramer	framer( serial );
+
+	SimUART::sink( LPUART1, []( uint8_t c ){
+		SimUART::input( LPUART1, &c, 1, false );
+
+		if ( capture )
+			fputc( c, capture );
+	} );
+
+	std::vector<record>	sent;
+	std::vector<record>	received;
+
+	framer.attach( [ & ]( const uint8_t *data, size_t length ){ received.emplace_back( data, data + length ); } );
+
+	srand( 1 );
+
+	for ( int i = 0; i < 200; i++ )
+	{
+		record	r( rand() % (FrameCodec::MAX_PAYLOAD + 1) );
+
+		for ( auto& b : r )
+			b	= (rand() % 3) ? rand() : 0x00;
+
+		if ( i == 1 )
+			r.assign( FrameCodec::MAX_PAYLOAD, 0x00 );
+		else if ( i == 2 )
+			r.assign( FrameCodec::MAX_PAYLOAD, 0xFF );
+		else if ( i == 3 )
+			r.clear();
+
+		sent.push_back( r );
+		framer.send( r.data(), r.size() );
+		framer.poll();
+	}
+
+	wait_us( 10000 );
+	framer.poll();
+
+	check( "records received in order",			sent == received );
+	check( "no errors on loopback",				!framer.decoder.crc_errors && !framer.decoder.format_errors );
+	check( "no RX overflow",					!serial.rx_dropped() && !serial.rx_overruns() );
+	check( "too long record rejected",			kStatus_InvalidArgument == framer.send( nullptr, FrameCodec::MAX_PAYLOAD + 1 ) );
+	check( "CRC-16/CCITT-FALSE check value",	0x29B1 == FrameCodec::crc16( (const uint8_t *)"123456789", 9 ) );
+
+	FrameCodec::Decoder	decoder;
+	uint8_t				frame[ FrameCodec::encoded_size( 10 ) ];
+	uint8_t				payload[ 10 ]	= { 1, 0, 2, 0, 0, 3, 4, 5, 0, 9 };
+	size_t				length			= FrameCodec::encode( payload, sizeof( payload ), frame );
+	int					valid			= 0;
+
+	frame[ 3 ]	^= 0x40;
+
+	for ( size_t i = 0; i < length; i++ )
+		valid	+= decoder.feed( frame[ i ] );
+
+	FrameCodec::encode( payload, sizeof( payload ), frame );
+
+	for ( size_t i = 0; i < length; i++ )
+		valid	+= decoder.feed( frame[ i ] );
+
+	check( "bit error detected and resynchronized",	(1 == valid) && (1 == decoder.crc_errors) && (sizeof( payload ) == decoder.length()) );
+
+	if ( capture )
+		fclose( capture );
+
+	return failures;
+}
@@ -0,0 +1,95 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/** Test of Serial::printf() output length limit on host (CPU_HOST) build
+ *
+ *	Output around the TX ring capacity (Serial::PRINTF_MAX_LENGTH) is given to printf() with each TX policy. 
+ *	Queued characters, characters on the wire and tx_dropped() are checked. 
+ *	A printf() which never finds its space in the ring is caught by a watchdog alarm.
+ *	Exit code is 0 if all checks passed.
+ *
+ *	Build as "Host build" in README.md with this file as the application.
+ */
+
+#include	<signal.h>
+#include	<unistd.h>
+#include	<string>
+
+#include	"r01lib.h"
+#include	"host_sim.h"
+
+static std::string	wire;
+static int			failures	= 0;
+
+static void check( const char *name, bool result )
+{
+	printf( "%-40s %s\n", name, result ? "ok" : "FAIL" );
+
+	if ( !result )
+		failures++;
+}
+
+static void timeout( int )
+{
+	const char	s[]	= "printf() hangs\n";
+
+	write( STDERR_FILENO, s, sizeof( s ) - 1 );
+	_exit( -1 );
+}
+
+static bool print( Serial& serial, size_t length, size_t expected, uint32_t dropped )
+{
+	std::string	s( length, 'x' );
+
+	wire.clear();
+	serial.clear_counters();
+
+	int	n	= serial.printf( "%s", s.c_str() );
+
+	wait_us( 10000 );
+
+	return ((int)expected == n) && (wire == s.substr( 0, expected )) && (dropped == serial.tx_dropped());
+}
+
+int main( void )
+{
+	const size_t	max	= Serial::PRINTF_MAX_LENGTH;
+
+	signal( SIGALRM, timeout );
+	alarm( 5 );
+
+	Serial	serial( MB_TX, MB_RX, 921600 );
+
+	SimUART::sink( LPUART1, []( uint8_t c ){ wire	+= (char)c; } );
+
+	check( "max length is TX_RING_BUF_SIZE - 2",	Serial::TX_RING_BUF_SIZE - 2 == max );
+
+	serial.tx_policy( Serial::Block );
+	check( "Block: max - 1",						print( serial, max - 1, max - 1, 0 ) );
+	check( "Block: max",							print( serial, max,     max,     0 ) );
+	check( "Block: max + 1",						print( serial, max + 1, max,     1 ) );
+	check( "Block: PRINTF_BUF_SIZE",				print( serial, Serial::PRINTF_BUF_SIZE, max, Serial::PRINTF_BUF_SIZE - max ) );
+	check( "Block: 1000",							print( serial, 1000,    max,     1000 - max ) );
+
+	serial.tx_policy( Serial::Truncate );
+	check( "Truncate: max",							print( serial, max,     max,     0 ) );
+	check( "Truncate: max + 1",						print( serial, max + 1, max,     1 ) );
+
+	serial.tx_policy( Serial::Drop );
+	check( "Drop: max",								print( serial, max,     max,     0 ) );
+	check( "Drop: max + 1",							print( serial, max + 1, max,     1 ) );
+
+	//	ring is partly filled: Block waits for the space, Truncate queues the part which fits
+	serial.tx_policy( Serial::Block );
+	wire.clear();
+	serial.clear_counters();
+	serial.printf( "%s", std::string( 100, 'a' ).c_str() );
+	serial.printf( "%s", std::string( max, 'b' ).c_str() );
+	wait_us( 10000 );
+	check( "Block: waits for space",				(wire == std::string( 100, 'a' ) + std::string( max, 'b' )) && !serial.tx_dropped() );
+
+	return failures;
+}
@@ -0,0 +1,66 @@
+/*
+ *  @author Tedd OKANO
+ *
+ *  Released under the MIT license
+ */
+
+/** Host-side decoder for SerialFramer output
+ *
+ *	Reads raw bytes from a file, a serial device or stdin and prints payload of each valid frame in hex. 
+ *	Frame counters are printed to stderr at end of input.
+ *	This uses FrameCodec only, so it is built without CPU_HOST simulation.
+ *
+ *	Build and usage:
+ *	@code
+ *	g++ -std=c++17 -Ir01lib r01lib/FrameCodec.cpp r01lib/host/tools/frame_decode.cpp -o frame_decode
+ *
+ *	stty -F /dev/ttyACM0 921600 raw
+ *	./frame_decode /dev/ttyACM0
+ *	./frame_decode < capture.bin
+ *	@endcode
+ */
+
+#include	<stdio.h>
+
+#include	"FrameCodec.h"
+
+int main( int argc, char *argv[] )
+{
+	FILE				*fp	= stdin;
+	FrameCodec::Decoder	decoder;
+	int					c;
+
+	if ( 1 < argc )
+	{
+		if ( !(fp = fopen( argv[ 1 ], "rb" )) )
+		{
+			fprintf( stderr, "cannot open %s\n", argv[ 1 ] );
+			return 1;
+		}
+	}
+
+	while ( EOF != (c = fgetc( fp )) )
+	{
+		if ( !decoder.feed( (uint8_t)c ) )
+			continue;
+
+		printf( "%3zu:", decoder.length() );
+
+		for ( size_t i = 0; i < decoder.length(); i++ )
+			printf( " %02X", decoder.data()[ i ] );
+
+		printf( "\n" );
+		fflush( stdout );
+	}
+
+	fprintf( stderr, "frames %lu, crc errors %lu, format errors %lu\n",
+			(unsigned long)decoder.frames,
+			(unsigned long)decoder.crc_errors,
+			(unsigned long)decoder.format_errors
+	);
+
+	if ( fp != stdin )
+		fclose( fp );
+
+	return 0;
+}
@@ -24,6 +24,12 @@ extern "C" {
 #include	"i2c.h"
 #include	"mcu.h"
 
+#if	CPU_MCXC444VLH
+#define	BUSY_STATUS		kStatus_I2C_Busy
+#else
+#define	BUSY_STATUS		kStatus_LPI2C_Busy
+#endif
+
 #ifdef	CPU_MCXN947VDF
 	#define EXAMPLE_I2C_MASTER_BASE			(LPI2C2_BASE)
 	#define LPI2C_MASTER_CLOCK_FREQUENCY 	CLOCK_GetLPFlexCommClkFreq( 2u )
@@ -38,6 +44,8 @@ extern "C" {
 	#define EXAMPLE_I2C_MASTER_BASE			LPI2C0
 	#define LPI2C_MASTER_CLOCK_FREQUENCY	CLOCK_GetLpi2cClkFreq()
 	#define EXAMPLE_I2C_MASTER				((LPI2C_Type *)EXAMPLE_I2C_MASTER_BASE)
+#elif	CPU_HOST
+	#define LPI2C_MASTER_CLOCK_FREQUENCY	CLOCK_GetLpi2cClkFreq( 0u )
 #elif	CPU_MCXC444VLH
 	#define I2C_MASTER_CLK_SRC				I2C0_CLK_SRC
 	#define I2C_MASTER_CLOCK_FREQUENCY      CLOCK_GetFreq(I2C0_CLK_SRC)
@@ -47,7 +55,9 @@ extern "C" {
 #endif
 
 
-I2C::I2C( int sda, int scl, bool no_hw ) : Obj( true ), _sda( sda ), _scl( scl ), err_cb( nullptr )
+I2C::I2C( int sda, int scl, bool no_hw )
+	: Obj( true ), unit_base( nullptr ), _sda( sda ), _scl( scl ), err_cb( nullptr ),
+	  async_handle_ready( false ), async_busy( false ), async_status( kStatus_Success )
 {
 	if ( no_hw )
 		return;
@@ -125,6 +135,16 @@ I2C::I2C( int sda, int scl, bool no_hw ) : Obj( true ), _sda( sda ), _scl( scl )
 	
 	RESET_ReleasePeripheralReset( kLPI2C0_RST_SHIFT_RSTn );
 	
+#elif	CPU_HOST
+	constexpr int	mux_setting	= kPORT_MuxAlt2;
+
+	if ( (sda == I2C_SDA) && (scl == I2C_SCL) )
+		unit_base	= LPI2C0;
+	else if ( (sda == MB_SDA) && (scl == MB_SCL) )
+		unit_base	= LPI2C1;
+	else
+		panic( "HOST supports I2C_SDA(D18)/I2C_SCL(D19) or MB_SDA/MB_SCL pins for I2C" );
+
 #elif	CPU_MCXC444VLH
 	int	mux_setting	= kPORT_MuxAlt2;
 
@@ -160,9 +180,18 @@ I2C::I2C( int sda, int scl, bool no_hw ) : Obj( true ), _sda( sda ), _scl( scl )
 
 I2C::~I2C()
 {
+	if ( !unit_base )
+		return;
+
 #if	CPU_MCXC444VLH
+	if ( async_busy )
+		I2C_MasterTransferAbort( unit_base, &async_handle );
+
 	I2C_MasterDeinit( unit_base );
 #else
+	if ( async_busy )
+		LPI2C_MasterTransferAbort( unit_base, &async_handle );
+
 	LPI2C_MasterDeinit( unit_base );
 #endif
 }
@@ -188,7 +217,7 @@ status_t I2C::write( uint8_t address, const uint8_t *dp, int length, bool stop )
 {
 	status_t	r;
 	
-	if ( (r = write_core( address, dp, length, stop )) )
+	if ( (r = async_busy ? (status_t)BUSY_STATUS : write_core( address, dp, length, stop )) )
 		if ( err_cb )
 			err_cb( r, address );
 	
@@ -199,7 +228,7 @@ status_t I2C::read( uint8_t address, uint8_t *dp, int length, bool stop )
 {
 	status_t	r;
 	
-	if ( (r = read_core( address, dp, length, stop )) )
+	if ( (r = async_busy ? (status_t)BUSY_STATUS : read_core( address, dp, length, stop )) )
 		if ( err_cb )
 			err_cb( r, address );
 
@@ -307,10 +336,13 @@ status_t I2C::read_core( uint8_t address, uint8_t *dp, int length, bool stop )
 			return reVal;
 		}
 
-		reVal = LPI2C_MasterStop( unit_base );
-		if ( reVal != kStatus_Success )
+		if ( stop )
 		{
-			return reVal;
+			reVal = LPI2C_MasterStop( unit_base );
+			if ( reVal != kStatus_Success )
+			{
+				return reVal;
+			}
 		}
 	}
 	return reVal;
@@ -318,6 +350,154 @@ status_t I2C::read_core( uint8_t address, uint8_t *dp, int length, bool stop )
 #endif
 
 
+status_t I2C::transfer_async( uint8_t targ, DIRECTION dir, uint8_t *dp, int length, xfer_cb_t callback, bool stop )
+{
+	return xfer_async( dir, targ, 0, 0, dp, length, stop, callback );
+}
+
+status_t I2C::reg_write_async( uint8_t targ, uint8_t reg, const uint8_t *dp, int length, xfer_cb_t callback )
+{
+	return xfer_async( WRITE, targ, reg, 1, const_cast<uint8_t *>( dp ), length, STOP, callback );
+}
+
+status_t I2C::reg_read_async( uint8_t targ, uint8_t reg, uint8_t *dp, int length, xfer_cb_t callback )
+{
+	return xfer_async( READ, targ, reg, 1, dp, length, STOP, callback );
+}
+
+bool I2C::busy( void )
+{
+	return async_busy;
+}
+
+status_t I2C::transfer_wait( void )
+{
+	while ( true )
+	{
+		//	sleep with interrupts masked to not miss the completion right before WFI
+		uint32_t	primask	= DisableGlobalIRQ();
+		bool		done	= !async_busy;
+
+		if ( !done )
+			__WFI();
+
+		EnableGlobalIRQ( primask );
+
+		if ( done )
+			break;
+	}
+
+	return async_status;
+}
+
+void I2C::async_done( status_t status )
+{
+	if ( !async_busy )
+		return;
+
+	//	callback can start next transfer
+	xfer_cb_t	cb	= std::move( async_cb );
+
+	async_cb		= nullptr;
+	async_status	= status;
+	last_status		= status;
+	async_busy		= false;
+
+	if ( cb )
+		cb( status );
+}
+
+#if	CPU_MCXC444VLH
+status_t I2C::xfer_async( DIRECTION dir, uint8_t targ, uint8_t reg, uint8_t reg_length, uint8_t *dp, int length, bool stop, xfer_cb_t callback )
+{
+	if ( !unit_base )
+		return kStatus_Fail;
+
+	if ( async_busy )
+		return BUSY_STATUS;
+
+	if ( !async_handle_ready )
+	{
+		I2C_MasterTransferCreateHandle( unit_base, &async_handle, async_callback, this );
+		async_handle_ready	= true;
+	}
+
+	i2c_master_transfer_t	masterXfer;
+	
+	memset( &masterXfer, 0, sizeof( masterXfer ) );
+
+	masterXfer.slaveAddress   = targ;
+	masterXfer.direction      = (dir == READ) ? kI2C_Read : kI2C_Write;
+	masterXfer.subaddress     = reg;
+	masterXfer.subaddressSize = reg_length;
+	masterXfer.data           = dp;
+	masterXfer.dataSize       = length;
+	masterXfer.flags          = kI2C_TransferDefaultFlag;
+
+	masterXfer.flags	|= !stop						? kI2C_TransferNoStopFlag			: 0x0;
+	masterXfer.flags	|= repeated_start_required_flag	? kI2C_TransferRepeatedStartFlag	: 0x0;
+
+	repeated_start_required_flag	= !stop;
+
+	async_cb	= callback;
+	async_busy	= true;
+
+	status_t	r	= I2C_MasterTransferNonBlocking( unit_base, &async_handle, &masterXfer );
+
+	if ( kStatus_Success != r )
+		async_busy	= false;
+
+	return r;
+}
+
+void I2C::async_callback( I2C_Type *, i2c_master_handle_t *, status_t status, void *userData )
+{
+	((I2C *)userData)->async_done( status );
+}
+#else
+status_t I2C::xfer_async( DIRECTION dir, uint8_t targ, uint8_t reg, uint8_t reg_length, uint8_t *dp, int length, bool stop, xfer_cb_t callback )
+{
+	if ( !unit_base )
+		return kStatus_Fail;
+
+	if ( async_busy )
+		return BUSY_STATUS;
+
+	if ( !async_handle_ready )
+	{
+		LPI2C_MasterTransferCreateHandle( unit_base, &async_handle, async_callback, this );
+		async_handle_ready	= true;
+	}
+
+	lpi2c_master_transfer_t	masterXfer;
+	
+	memset( &masterXfer, 0, sizeof( masterXfer ) );
+
+	masterXfer.slaveAddress   = targ;
+	masterXfer.direction      = (dir == READ) ? kLPI2C_Read : kLPI2C_Write;
+	masterXfer.subaddress     = reg;
+	masterXfer.subaddressSize = reg_length;
+	masterXfer.data           = dp;
+	masterXfer.dataSize       = length;
+	masterXfer.flags          = stop ? kLPI2C_TransferDefaultFlag : kLPI2C_TransferNoStopFlag;
+
+	async_cb	= callback;
+	async_busy	= true;
+
+	status_t	r	= LPI2C_MasterTransferNonBlocking( unit_base, &async_handle, &masterXfer );
+
+	if ( kStatus_Success != r )
+		async_busy	= false;
+
+	return r;
+}
+
+void I2C::async_callback( LPI2C_Type *, lpi2c_master_handle_t *, status_t status, void *userData )
+{
+	((I2C *)userData)->async_done( status );
+}
+#endif
+
 status_t I2C::reg_write( uint8_t targ, uint8_t reg, const uint8_t *dp, int length )
 {
 	uint8_t	bp[ REG_RW_BUFFER_SIZE ];
@@ -378,6 +558,17 @@ I2C::err_cb_ptr I2C::err_callback( err_cb_ptr callback )
 	return previous_cb;
 }
 
+status_t I2C::stop_condition( void )
+{
+#if	CPU_MCXC444VLH
+	repeated_start_required_flag	= false;
+
+	return I2C_MasterStop( unit_base );
+#else
+	return LPI2C_MasterStop( unit_base );
+#endif
+}
+
 void I2C::err_handling( status_t error, uint8_t address )
 {
 #if	CPU_MCXC444VLH
@@ -394,13 +585,13 @@ void I2C::err_handling( status_t error, uint8_t address )
 bool I2C::ping( uint8_t addr )
 {
 	uint8_t	dummy	= 0;
-	return !write_core( addr, &dummy, 0 );
+	return !async_busy && !write_core( addr, &dummy, 0 );
 }
 
 void I2C::scan( uint8_t start, uint8_t last, bool *result )
 {
 	for ( uint8_t i = 0; i <= last; i++ )
-		result[i]	= ping( i );
+		result[i]	= (start <= i) && ping( i );
 }
 
 void I2C::scan( uint8_t start, uint8_t last )
@@ -431,6 +622,94 @@ void I2C::scan( uint8_t last )
 	scan( 0, last );
 }
 
+I2C::Batch::Batch( I2C& bus ) : i2c( bus )
+{
+}
+
+I2C::Batch::~Batch()
+{
+}
+
+int I2C::Batch::reg_write( uint8_t targ, uint8_t reg, const uint8_t *dp, int length )
+{
+	entries.push_back( { targ, reg, WRITE, const_cast<uint8_t *>( dp ), length, 0, kStatus_Success } );
+	return entries.size() - 1;
+}
+
+int I2C::Batch::reg_write( uint8_t targ, uint8_t reg, uint8_t data )
+{
+	entries.push_back( { targ, reg, WRITE, nullptr, 1, data, kStatus_Success } );
+	return entries.size() - 1;
+}
+
+int I2C::Batch::reg_read( uint8_t targ, uint8_t reg, uint8_t *dp, int length )
+{
+	entries.push_back( { targ, reg, READ, dp, length, 0, kStatus_Success } );
+	return entries.size() - 1;
+}
+
+status_t I2C::Batch::execute( void )
+{
+	status_t				r		= kStatus_Success;
+	int						last	= entries.size() - 1;
+	int						i		= 0;
+	std::vector<uint8_t>	bp;
+
+	for ( auto& e : entries )
+	{
+		bool	stop	= (i++ == last) ? STOP : NO_STOP;
+
+		if ( kStatus_Success != r )
+		{
+			e.status	= kStatus_NoTransferInProgress;
+			continue;
+		}
+
+		if ( WRITE == e.dir )
+		{
+			bp.resize( e.length + 1 );
+
+			bp[ 0 ]	= e.reg;
+			memcpy( bp.data() + 1, e.dp ? e.dp : &e.data, e.length );
+
+			e.status	= i2c.write( e.targ, bp.data(), e.length + 1, stop );
+		}
+		else
+		{
+			e.status	= i2c.write( e.targ, &e.reg, sizeof( e.reg ), NO_STOP );
+
+			if ( kStatus_Success == e.status )
+				e.status	= i2c.read( e.targ, e.dp, e.length, stop );
+		}
+
+		//	release the bus at first error. following entries are not performed
+		if ( kStatus_Success != e.status )
+		{
+			r	= e.status;
+			i2c.stop_condition();
+		}
+	}
+
+	i2c.last_status	= r;
+
+	return r;
+}
+
+status_t I2C::Batch::status( int index )
+{
+	return entries[ index ].status;
+}
+
+int I2C::Batch::count( void )
+{
+	return entries.size();
+}
+
+void I2C::Batch::clear( void )
+{
+	entries.clear();
+}
+
 status_t I2C::ccc_set( uint8_t ccc, uint8_t addr, uint8_t data )
 {
 	return kStatus_Success;
@@ -8,6 +8,8 @@
 #define R01LIB_I2C_H
 
 #include	<string.h>
+#include	<functional>
+#include	<vector>
 
 #ifdef	CPU_MCXC444VLH
 #include "fsl_i2c.h"
@@ -34,6 +36,16 @@ public:
 	/** defining pointer to NAK callback	*/
 	typedef void (*err_cb_ptr)( status_t status, uint8_t address );
 
+	/** defining callback for non-blocking transfer completion	*/
+	using xfer_cb_t	= std::function<void( status_t status )>;
+
+	/** constants for transfer direction  */
+	enum DIRECTION
+	{
+		WRITE,
+		READ
+	};
+
 	/** constants for STOP-cindition setting  */
 	enum STOP_CONDITION
 	{
@@ -120,7 +132,7 @@ public:
 	 * @param dp data to write
 	 * @param length data length
 	 * @param stop (option) generate STOP condition: "false" to make repeated-start in next transaction
-	 * @return status_t
+	 * @return status_t. busy status while a non-blocking transfer is ongoing
 	 */
 	virtual status_t	write( uint8_t address, const uint8_t *dp, int length, bool stop = STOP );
 
@@ -139,7 +151,7 @@ public:
 	 * @param dp data buffer for read
 	 * @param length data length
 	 * @param stop (option) generate STOP condition: "false" to make repeated-start in next transaction
-	 * @return status_t
+	 * @return status_t. busy status while a non-blocking transfer is ongoing
 	 */
 	virtual status_t	read( uint8_t address, uint8_t *dp, int length, bool stop = STOP );
 
@@ -154,6 +166,57 @@ public:
 	 */
 	virtual uint8_t		read( uint8_t targ, bool stop = STOP );
 
+	/** Non-blocking transfer
+	 *	starts a transfer and returns immediately.
+	 *	the transfer is performed by interrupt and the callback is called in interrupt context when it is done
+	 *	error handling callback (err_callback) is not called. the result is given to the callback as status
+	 *
+	 * @param targ target address
+	 * @param dir I2C::WRITE or I2C::READ
+	 * @param dp data buffer. It needs to be kept available until the transfer completes
+	 * @param length data length
+	 * @param callback (option) function to be called at transfer completion
+	 * @param stop (option) generate STOP condition: "false" to make repeated-start in next transaction
+	 * @return status_t kStatus_Success if the transfer started
+	 */
+	virtual status_t	transfer_async( uint8_t targ, DIRECTION dir, uint8_t *dp, int length, xfer_cb_t callback = nullptr, bool stop = STOP );
+
+	/** Non-blocking register write
+	 *	register address and data are sent in one transaction
+	 *
+	 * @param targ target address
+	 * @param reg register address
+	 * @param dp data to write. It needs to be kept available until the transfer completes
+	 * @param length data length
+	 * @param callback (option) function to be called at transfer completion
+	 * @return status_t kStatus_Success if the transfer started
+	 */
+	virtual status_t	reg_write_async( uint8_t targ, uint8_t reg, const uint8_t *dp, int length, xfer_cb_t callback = nullptr );
+
+	/** Non-blocking register read
+	 *	register address write and data read are done with repeated-START
+	 *
+	 * @param targ target address
+	 * @param reg register address
+	 * @param dp data buffer for read. It needs to be kept available until the transfer completes
+	 * @param length data length
+	 * @param callback (option) function to be called at transfer completion
+	 * @return status_t kStatus_Success if the transfer started
+	 */
+	virtual status_t	reg_read_async( uint8_t targ, uint8_t reg, uint8_t *dp, int length, xfer_cb_t callback = nullptr );
+
+	/** Non-blocking transfer state
+	 *
+	 * @return true if a non-blocking transfer is ongoing
+	 */
+	virtual bool		busy( void );
+
+	/** Wait non-blocking transfer completion
+	 *
+	 * @return status_t result of the last non-blocking transfer
+	 */
+	virtual status_t	transfer_wait( void );
+
 	/** registering error handling method
 	 *
 	 * @param err_cb_ptr pointer to error handling method. use "nullptr" to suppress any actions
@@ -226,22 +289,129 @@ public:
 	/** variable for reporting last state */
 	status_t				last_status;
 
+	/** Batch class
+	 *
+	 *  @class Batch
+	 *
+	 *	A class to record register accesses for multiple targets and perform them in one go.
+	 *	Recorded transactions are chained by repeated-START and a STOP condition is generated only at the end.
+	 *	Data buffers given for recording need to be kept available until execute() is called.
+	 *	Recorded entries are kept after execute() so the same batch can be performed repeatedly.
+	 */
+	class Batch
+	{
+	public:
+		/** Create a Batch instance
+		 *
+		 * @param bus I2C instance to perform the transactions
+		 */
+		Batch( I2C& bus );
+
+		/** Destructor of Batch
+		 */
+		virtual ~Batch();
+
+		/** Record register write (multiple byte data)
+		 *
+		 * @param targ target address
+		 * @param reg register address
+		 * @param dp data to write
+		 * @param length data length
+		 * @return index of recorded entry
+		 */
+		int			reg_write( uint8_t targ, uint8_t reg, const uint8_t *dp, int length );
+
+		/** Record register write (single byte data)
+		 *	data is copied into the batch
+		 *
+		 * @param targ target address
+		 * @param reg register address
+		 * @param data data to write
+		 * @return index of recorded entry
+		 */
+		int			reg_write( uint8_t targ, uint8_t reg, uint8_t data );
+
+		/** Record register read
+		 *
+		 * @param targ target address
+		 * @param reg register address
+		 * @param dp data buffer for read
+		 * @param length data length
+		 * @return index of recorded entry
+		 */
+		int			reg_read( uint8_t targ, uint8_t reg, uint8_t *dp, int length );
+
+		/** Perform all recorded transactions
+		 *	at first error, STOP condition is generated and following entries are not performed.
+		 *	status() of those entries gives kStatus_NoTransferInProgress
+		 *
+		 * @return status_t kStatus_Success if all entries succeeded, otherwise the first error
+		 */
+		status_t	execute( void );
+
+		/** Result of each entry
+		 *
+		 * @param index index of entry returned when it was recorded
+		 * @return status_t result of last execution
+		 */
+		status_t	status( int index );
+
+		/** Number of recorded entries
+		 *
+		 * @return number of entries
+		 */
+		int			count( void );
+
+		/** Clear all recorded entries
+		 */
+		void		clear( void );
+
+	private:
+		typedef struct	_entry {
+			uint8_t		targ;
+			uint8_t		reg;
+			DIRECTION	dir;
+			uint8_t		*dp;
+			int			length;
+			uint8_t		data;
+			status_t	status;
+		} entry;
+
+		I2C&				i2c;
+		std::vector<entry>	entries;
+	};
+
 protected:
 	virtual status_t	write_core( uint8_t address, const uint8_t *dp, int length, bool stop = STOP );
 	virtual status_t	read_core( uint8_t address, uint8_t *dp, int length, bool stop = STOP );
+	virtual status_t	stop_condition( void );
 	
 private:
+	status_t			xfer_async( DIRECTION dir, uint8_t targ, uint8_t reg, uint8_t reg_length, uint8_t *dp, int length, bool stop, xfer_cb_t callback );
+	void				async_done( status_t status );
+
 #if	CPU_MCXC444VLH
+	static void			async_callback( I2C_Type *base, i2c_master_handle_t *handle, status_t status, void *userData );
+
 	i2c_master_config_t		masterConfig;
 	I2C_Type				*unit_base;
 	bool					repeated_start_required_flag;
+	i2c_master_handle_t		async_handle;
 #else
+	static void			async_callback( LPI2C_Type *base, lpi2c_master_handle_t *handle, status_t status, void *userData );
+
 	lpi2c_master_config_t	masterConfig;
 	LPI2C_Type				*unit_base;
+	lpi2c_master_handle_t	async_handle;
 #endif
 	DigitalInOut			_sda;
 	DigitalInOut			_scl;
 	err_cb_ptr				err_cb;
+
+	bool					async_handle_ready;
+	volatile bool			async_busy;
+	volatile status_t		async_status;
+	xfer_cb_t				async_cb;
 };
 
 #endif // R01LIB_I2C_H
@@ -13,9 +13,12 @@ extern "C" {
 #include	"fsl_i3c.h"
 }
 
+#include	<atomic>
+
 #include	"i3c.h"
+#include	"mcu.h"
 
-#define	IBI_PAYLOAD_BUFFER_SIZE		10
+#define	IBI_PAYLOAD_BUFFER_SIZE		I3C::IBI_PAYLOAD_SIZE
 
 #ifdef	CPU_MCXN947VDF
 	#define EXAMPLE_MASTER            	I3C1
@@ -34,10 +37,11 @@ extern "C" {
 #endif
 
 uint8_t					g_ibiBuff[ IBI_PAYLOAD_BUFFER_SIZE ];
-static uint8_t			g_ibiUserBuff[ IBI_PAYLOAD_BUFFER_SIZE ];
-static uint8_t			g_ibiUserBuffUsed	= 0;
-static volatile bool	g_ibiWonFlag		= false;
-static uint8_t 			g_ibiAddress;
+
+static I3C::ibi_event			ibi_queue[ I3C::IBI_QUEUE_DEPTH ];
+static std::atomic<uint32_t>	ibi_head( 0 );
+static std::atomic<uint32_t>	ibi_tail( 0 );
+static volatile uint32_t		ibi_overrun	= 0;
 
 i3c_master_handle_t		g_i3c_m_handle;
 volatile bool			g_masterCompletionFlag;
@@ -47,7 +51,7 @@ i3c_func_ptr			g_ibi_callback	= NULL;
 
 //I3C::I3C( int sda, int scl )
 I3C::I3C( int sda, int scl, uint32_t i2c_freq, uint32_t i3c_od_freq, uint32_t i3c_pp_freq )
-	: I2C( sda, scl, true )
+	: I2C( sda, scl, true ), async_busy( false ), async_status( kStatus_Success ), async_xfer{}, async_retries( 0 )
 {
 #ifdef	CPU_MCXN947VDF
 	if ( (sda == I3C_SDA) && (scl == I3C_SCL) )
@@ -89,11 +93,15 @@ I3C::I3C( int sda, int scl, uint32_t i2c_freq, uint32_t i3c_od_freq, uint32_t i3
 	
 	I3C_MasterInit( EXAMPLE_MASTER, &masterConfig, I3C_MASTER_CLOCK_FREQUENCY );
 
-	/* Create I3C handle. */
-	I3C_MasterTransferCreateHandle( EXAMPLE_MASTER, &g_i3c_m_handle, &masterCallback, NULL );
+	/* Create I3C handle. Completion of non-blocking transfer is given to this instance */
+	I3C_MasterTransferCreateHandle( EXAMPLE_MASTER, &g_i3c_m_handle, &masterCallback, this );
 
 	first_broadcast	= true;
 	
+	memset( ddr_checked, 0, sizeof( ddr_checked ) );
+	memset( ddr_supported, 0, sizeof( ddr_supported ) );
+	memset( ibi_handlers, 0, sizeof( ibi_handlers ) );
+
 	DigitalInOut	_scl( sda );
 	DigitalInOut	_sda( scl );
 	
@@ -102,6 +110,9 @@ I3C::I3C( int sda, int scl, uint32_t i2c_freq, uint32_t i3c_od_freq, uint32_t i3
 }
 
 I3C::~I3C(){
+	if ( async_busy )
+		I3C_MasterTransferAbort( EXAMPLE_MASTER, &g_i3c_m_handle );
+
 	I3C_MasterDeinit( EXAMPLE_MASTER );
 }
 
@@ -136,17 +147,145 @@ status_t I3C::read( uint8_t targ, uint8_t *dp, int length, bool stop )
 	return xfer( kI3C_Read, bus_type, targ, dp, length, stop );
 }
 
+status_t I3C::stop_condition( void )
+{
+	return I3C_MasterStop( EXAMPLE_MASTER );
+}
+
+status_t I3C::transfer_async( uint8_t targ, DIRECTION dir, uint8_t *dp, int length, xfer_cb_t callback, bool stop )
+{
+	return xfer_async( (WRITE == dir) ? kI3C_Write : kI3C_Read, targ, 0, 0, dp, length, stop, callback );
+}
+
+status_t I3C::reg_write_async( uint8_t targ, uint8_t reg, const uint8_t *dp, int length, xfer_cb_t callback )
+{
+	return xfer_async( kI3C_Write, targ, reg, 1, const_cast<uint8_t *>( dp ), length, STOP, callback );
+}
+
+status_t I3C::reg_read_async( uint8_t targ, uint8_t reg, uint8_t *dp, int length, xfer_cb_t callback )
+{
+	return xfer_async( kI3C_Read, targ, reg, 1, dp, length, STOP, callback );
+}
+
+bool I3C::busy( void )
+{
+	return async_busy;
+}
+
+status_t I3C::transfer_wait( void )
+{
+	while ( true )
+	{
+		//	sleep with interrupts masked to not miss the completion right before WFI
+		uint32_t	primask	= DisableGlobalIRQ();
+		bool		done	= !async_busy;
+
+		if ( !done )
+			__WFI();
+
+		EnableGlobalIRQ( primask );
+
+		if ( done )
+			break;
+	}
+
+	return async_status;
+}
+
+status_t I3C::xfer_async( i3c_direction_t dir, uint8_t targ, uint8_t reg, uint8_t reg_length, uint8_t *dp, int length, bool stop, xfer_cb_t callback )
+{
+	if ( async_busy )
+		return kStatus_I3C_Busy;
+
+	i3c_master_transfer_t masterXfer = {0};
+	
+	masterXfer.slaveAddress		= targ;
+	masterXfer.subaddress   	= reg;
+	masterXfer.subaddressSize	= reg_length;
+	masterXfer.data        		= dp;
+	masterXfer.dataSize			= length;
+	masterXfer.direction		= dir;
+	masterXfer.busType			= xfer_type( bus_type, targ, reg, reg_length, length );
+	masterXfer.flags			= stop ? kI3C_TransferDefaultFlag : kI3C_TransferNoStopFlag;
+
+	if ( kI3C_TypeI3CDdr == masterXfer.busType )
+	{
+		masterXfer.subaddress	= (kI3C_Read == dir) ? (reg | DDR_READ_CMD) : reg;
+		masterXfer.flags		= kI3C_TransferDefaultFlag;
+	}
+
+	//	kept to start the transfer again in async_done()
+	async_xfer		= masterXfer;
+	async_retries	= 0;
+	async_cb		= callback;
+	async_busy		= true;
+
+	status_t	r	= I3C_MasterTransferNonBlocking( EXAMPLE_MASTER, &g_i3c_m_handle, &async_xfer );
+
+	if ( kStatus_Success != r )
+		async_busy	= false;
+
+	return r;
+}
+
+void I3C::async_done( status_t status )
+{
+	if ( !async_busy )
+		return;
+
+	//	an IBI won the arbitration of the address header. the IBI is queued by master_ibi_callback() and the transfer is not done yet
+	if ( (kStatus_I3C_IBIWon == status) && (async_retries < IBI_WON_RETRIES) )
+	{
+		async_retries++;
+
+		if ( kStatus_Success == I3C_MasterTransferNonBlocking( EXAMPLE_MASTER, &g_i3c_m_handle, &async_xfer ) )
+			return;
+	}
+
+	//	fallback to SDR for the target, same as reg_xfer()
+	if ( (kStatus_I3C_Nak == status) && (kI3C_TypeI3CDdr == async_xfer.busType) )
+	{
+		ddr_capable( async_xfer.slaveAddress, false );
+
+		async_xfer.subaddress	&= ~DDR_READ_CMD;
+		async_xfer.busType		 = kI3C_TypeI3CSdr;
+
+		if ( kStatus_Success == I3C_MasterTransferNonBlocking( EXAMPLE_MASTER, &g_i3c_m_handle, &async_xfer ) )
+			return;
+	}
+
+	//	callback can start next transfer
+	xfer_cb_t	cb	= std::move( async_cb );
+
+	async_cb		= nullptr;
+	async_status	= status;
+	async_busy		= false;
+
+	if ( cb )
+		cb( status );
+}
+
 #ifdef	CUSTOM_REGISTAR_XFER
-status_t I3C::reg_write( uint8_t targ, uint8_t reg, const uint8_t *dp, int length, bool stop )
+status_t I3C::reg_write( uint8_t targ, uint8_t reg, const uint8_t *dp, int length )
 {
 	return reg_xfer( kI3C_Write, bus_type, targ, reg, 1, (uint8_t *)dp, length );
 }
 
-status_t I3C::reg_read( uint8_t targ, uint8_t reg, uint8_t *dp, int length, bool stop )
+status_t I3C::reg_write( uint8_t targ, uint8_t reg, const uint8_t *dp, int length, bool stop )
+{
+	return reg_write( targ, reg, dp, length );
+}
+
+status_t I3C::reg_read( uint8_t targ, uint8_t reg, uint8_t *dp, int length )
 {
 	return reg_xfer( kI3C_Read, bus_type, targ, reg, 1, dp, length );
 }
 
+status_t I3C::reg_read( uint8_t targ, uint8_t reg, uint8_t *dp, int length, bool stop )
+{
+	return reg_read( targ, reg, dp, length );
+}
+
 status_t I3C::reg_xfer( i3c_direction_t dir, i3c_bus_type_t type, uint8_t targ, uint8_t reg, uint8_t reg_length, uint8_t *dp, int length, bool stop )
 {
 	i3c_master_transfer_t masterXfer = {0};
@@ -160,12 +299,35 @@ status_t I3C::reg_xfer( i3c_direction_t dir, i3c_bus_type_t type, uint8_t targ,
 	masterXfer.busType			= type;
 	masterXfer.flags			= stop ? kI3C_TransferDefaultFlag : kI3C_TransferNoStopFlag;
 	
+	if ( async_busy )
+		return kStatus_I3C_Busy;
+
+	masterXfer.busType	= xfer_type( type, targ, reg, reg_length, length );
+
+	if ( kI3C_TypeI3CDdr != masterXfer.busType )
+		return I3C_MasterTransferBlocking( EXAMPLE_MASTER, &masterXfer );
+
+	//	HDR-DDR: register address is the command code, bit7 set for read. CRC is generated and checked by the controller
+	masterXfer.subaddress	= (kI3C_Read == dir) ? (reg | DDR_READ_CMD) : reg;
+	masterXfer.flags		= kI3C_TransferDefaultFlag;
+
+	status_t	r	= I3C_MasterTransferBlocking( EXAMPLE_MASTER, &masterXfer );
+
+	if ( kStatus_I3C_Nak != r )
+		return r;
+
+	//	fallback to SDR for the target
+	ddr_capable( targ, false );
+
+	masterXfer.subaddress	= reg;
+	masterXfer.busType		= kI3C_TypeI3CSdr;
+
 	return I3C_MasterTransferBlocking( EXAMPLE_MASTER, &masterXfer );
 }
 
 status_t I3C::xfer( i3c_direction_t dir, i3c_bus_type_t type, uint8_t targ, uint8_t *dp, int length, bool stop )
 {
-	return reg_xfer( dir, bus_type, targ, 0, 0, dp, length, stop );
+	return reg_xfer( dir, type, targ, 0, 0, dp, length, stop );
 }
 #else
 status_t I3C::xfer( i3c_direction_t dir, i3c_bus_type_t type, uint8_t targ, uint8_t *dp, int length, bool stop )
@@ -179,10 +341,58 @@ status_t I3C::xfer( i3c_direction_t dir, i3c_bus_type_t type, uint8_t targ, uint
 	masterXfer.busType      = type;
 	masterXfer.flags        = stop ? kI3C_TransferDefaultFlag : kI3C_TransferNoStopFlag;
 	
+	if ( async_busy )
+		return kStatus_I3C_Busy;
+
 	return I3C_MasterTransferBlocking( EXAMPLE_MASTER, &masterXfer );
 }
 #endif	// CUSTOM_REGISTAR_XFER
 
+i3c_bus_type_t I3C::xfer_type( i3c_bus_type_t type, uint8_t targ, uint8_t reg, uint8_t reg_length, int length )
+{
+	if ( kI3C_TypeI3CDdr != type )
+		return type;
+
+	//	HDR-DDR carries 7 bit command code and 16 bit data words
+	if ( (1 != reg_length) || (reg & DDR_READ_CMD) || !length || (length & 1) || !hdr_ddr_capable( targ ) )
+		return kI3C_TypeI3CSdr;
+
+	return kI3C_TypeI3CDdr;
+}
+
+bool I3C::hdr_ddr_capable( uint8_t targ )
+{
+	uint32_t	bit	= 1UL << (targ % 32);
+	int			idx	= (targ / 32) % 4;
+
+	if ( !(ddr_checked[ idx ] & bit) )
+	{
+		uint8_t	bcr		= 0;
+		uint8_t	caps	= 0;
+		bool	capable;
+
+		capable	=  (kStatus_Success == ccc_get( DIRECT_GETBCR,  targ, &bcr,  1 )) && (bcr  & BCR_HDR_CAPABLE)
+				&& (kStatus_Success == ccc_get( DIRECT_GETCAPS, targ, &caps, 1 )) && (caps & CAPS_HDR_DDR);
+
+		ddr_capable( targ, capable );
+	}
+
+	return ddr_supported[ idx ] & bit;
+}
+
+void I3C::ddr_capable( uint8_t targ, bool capable )
+{
+	uint32_t	bit	= 1UL << (targ % 32);
+	int			idx	= (targ / 32) % 4;
+
+	ddr_checked[ idx ]	|= bit;
+
+	if ( capable )
+		ddr_supported[ idx ]	|=  bit;
+	else
+		ddr_supported[ idx ]	&= ~bit;
+}
+
 void I3C::set_IBI_callback( i3c_func_ptr fp )
 {
 	g_ibi_callback	= fp;
@@ -202,69 +412,170 @@ status_t I3C::ccc_broadcast( uint8_t ccc, const uint8_t *dp, uint8_t length, boo
 		first_broadcast	= false;
 		
 		frequency( 0, 2000000, 2000000 );	//	I2C_freq = default, I3C_OD_freq = 2MHz, I3C_PP_freq = 2MHz
-		r_code	= write( BROADCAST_ADDR, bp, length + 1 );
+		r_code	= xfer( kI3C_Write, ccc_type(), BROADCAST_ADDR, bp, length + 1 );
 		frequency();	//	revert to default frequency
 	}
 	else
 	{
-		r_code	= write( BROADCAST_ADDR, bp, length + 1 );
+		r_code	= xfer( kI3C_Write, ccc_type(), BROADCAST_ADDR, bp, length + 1 );
 	}
 	return r_code;
 }
 
 status_t I3C::ccc_set( uint8_t ccc, uint8_t addr, uint8_t data )
 {
-	status_t r	= write( BROADCAST_ADDR, &ccc, 1, NO_STOP );
+	status_t r	= xfer( kI3C_Write, ccc_type(), BROADCAST_ADDR, &ccc, 1, NO_STOP );
 
 	if ( kStatus_Success != r )
 		return r;
 	
-	return write( addr, &data, 1 );
+	return xfer( kI3C_Write, ccc_type(), addr, &data, 1 );
 }
 
 status_t I3C::ccc_get( uint8_t ccc, uint8_t addr, uint8_t *dp, uint8_t length )
 {
-	status_t r	= write( BROADCAST_ADDR, &ccc, 1, NO_STOP );
+	status_t r	= xfer( kI3C_Write, ccc_type(), BROADCAST_ADDR, &ccc, 1, NO_STOP );
 
 	if ( kStatus_Success != r )
 		return r;
 	
-	return read( addr, dp, length );
+	return xfer( kI3C_Read, ccc_type(), addr, dp, length );
+}
+
+i3c_bus_type_t I3C::ccc_type( void )
+{
+	//	CCCs are sent in SDR even in HDR-DDR mode
+	return (kI3C_TypeI3CDdr == bus_type) ? kI3C_TypeI3CSdr : bus_type;
 }
 
 uint8_t I3C::check_IBI( void )
 {
-	if ( !g_ibiWonFlag )
+	ibi_event	e;
+
+	if ( !ibi_read( e ) )
 		return 0;
 
-	g_ibiWonFlag	= false;
-	
-	return g_ibiAddress;
+	return e.address;
+}
+
+bool I3C::ibi_read( ibi_event& event )
+{
+	uint32_t	tail	= ibi_tail.load( std::memory_order_relaxed );
+	uint32_t	head	= ibi_head.load( std::memory_order_acquire );
+
+	if ( head == tail )
+		return false;
+
+	event	= ibi_queue[ tail % IBI_QUEUE_DEPTH ];
+	ibi_tail.store( tail + 1, std::memory_order_release );
+
+	return true;
+}
+
+int I3C::ibi_available( void )
+{
+	return ibi_head.load( std::memory_order_acquire ) - ibi_tail.load( std::memory_order_relaxed );
+}
+
+uint32_t I3C::ibi_overruns( void )
+{
+	return ibi_overrun;
+}
+
+bool I3C::ibi_handler( uint8_t address, ibi_cb_ptr func, void *context )
+{
+	ibi_entry	*empty	= nullptr;
+
+	for ( auto& h : ibi_handlers )
+	{
+		if ( h.func && (h.address == address) )
+		{
+			h.func		= func;
+			h.context	= context;
+
+			return true;
+		}
+
+		if ( !h.func && !empty )
+			empty	= &h;
+	}
+
+	if ( !func )
+		return true;
+
+	if ( !empty )
+		return false;
+
+	*empty	= { address, func, context };
+
+	return true;
+}
+
+int I3C::ibi_dispatch( void )
+{
+	ibi_event	e;
+	int			count	= 0;
+
+	while ( ibi_read( e ) )
+	{
+		for ( auto& h : ibi_handlers )
+		{
+			if ( h.func && (h.address == e.address) )
+			{
+				h.func( e, h.context );
+				break;
+			}
+		}
+
+		count++;
+	}
+
+	return count;
 }
 
 void I3C::master_ibi_callback( I3C_Type *base, i3c_master_handle_t *handle, i3c_ibi_type_t ibiType, i3c_ibi_state_t ibiState )
 {
-	g_ibiWonFlag	= true;
-	g_ibiAddress	= handle->ibiAddress;
-	
 	switch ( ibiType )
 	{
 		case kI3C_IbiNormal:
 			if ( ibiState == kI3C_IbiDataBuffNeed )
 			{
 				handle->ibiBuff = g_ibiBuff;
-			}
-			else
-			{
-				memcpy( g_ibiUserBuff, (void *)handle->ibiBuff, handle->ibiPayloadSize );
-				g_ibiUserBuffUsed = handle->ibiPayloadSize;
+				return;
 			}
 			break;
 
+		case kI3C_IbiHotJoin:
+			handle->ibiPayloadSize	= 0;
+			break;
+
 		default:
 			assert(false);
 			break;
 	}
+
+	uint32_t	time	= us_count();
+	uint32_t	head	= ibi_head.load( std::memory_order_relaxed );
+	uint32_t	tail	= ibi_tail.load( std::memory_order_acquire );
+
+	if ( IBI_QUEUE_DEPTH <= head - tail )
+	{
+		ibi_overrun	= ibi_overrun + 1;
+	}
+	else
+	{
+		ibi_event	*e		= &ibi_queue[ head % IBI_QUEUE_DEPTH ];
+		size_t		size	= handle->ibiBuff ? handle->ibiPayloadSize : 0;
+
+		size		= (size < IBI_PAYLOAD_SIZE) ? size : IBI_PAYLOAD_SIZE;
+		e->address	= (kI3C_IbiHotJoin == ibiType) ? HOT_JOIN_ADDR : handle->ibiAddress;
+		e->length	= size;
+		e->mdb		= size ? handle->ibiBuff[ 0 ] : 0;
+		e->time		= time;
+		memcpy( e->payload, (void *)handle->ibiBuff, size );
+
+		ibi_head.store( head + 1, std::memory_order_release );
+	}
 	
 	if ( g_ibi_callback )
 		g_ibi_callback();
@@ -276,6 +587,9 @@ void I3C::master_callback( I3C_Type *base, i3c_master_handle_t *handle, status_t
 		g_masterCompletionFlag = true;
 
 	g_completionStatus = status;
+
+	if ( userData )
+		((I3C *)userData)->async_done( status );
 }
 
 const i3c_master_transfer_callback_t	I3C::masterCallback = {
@@ -285,10 +599,135 @@ const i3c_master_transfer_callback_t	I3C::masterCallback = {
 };
 
 
+I3C::CCCSequence::CCCSequence( I3C& bus ) : i3c( bus )
+{
+}
+
+I3C::CCCSequence::~CCCSequence()
+{
+}
+
+int I3C::CCCSequence::broadcast( uint8_t ccc, const uint8_t *dp, int length )
+{
+	entries.push_back( { ccc, NO_DEFINING_BYTE, BROADCAST_ADDR, kI3C_Write, const_cast<uint8_t *>( dp ), length, 0, kStatus_Success } );
+	return entries.size() - 1;
+}
+
+int I3C::CCCSequence::broadcast( uint8_t ccc, uint8_t data )
+{
+	entries.push_back( { ccc, NO_DEFINING_BYTE, BROADCAST_ADDR, kI3C_Write, nullptr, 1, data, kStatus_Success } );
+	return entries.size() - 1;
+}
+
+int I3C::CCCSequence::direct_set( uint8_t ccc, uint8_t targ, const uint8_t *dp, int length, int defining_byte )
+{
+	entries.push_back( { ccc, defining_byte, targ, kI3C_Write, const_cast<uint8_t *>( dp ), length, 0, kStatus_Success } );
+	return entries.size() - 1;
+}
+
+int I3C::CCCSequence::direct_set( uint8_t ccc, uint8_t targ, uint8_t data, int defining_byte )
+{
+	entries.push_back( { ccc, defining_byte, targ, kI3C_Write, nullptr, 1, data, kStatus_Success } );
+	return entries.size() - 1;
+}
+
+int I3C::CCCSequence::direct_get( uint8_t ccc, uint8_t targ, uint8_t *dp, int length, int defining_byte )
+{
+	entries.push_back( { ccc, defining_byte, targ, kI3C_Read, dp, length, 0, kStatus_Success } );
+	return entries.size() - 1;
+}
+
+status_t I3C::CCCSequence::execute( void )
+{
+	status_t	r		= kStatus_Success;
+	int			last	= entries.size() - 1;
+	int			i		= 0;
+	int			header	= -1;	//	CCC and defining byte of current direct CCC frame
+	bool		slow	= i3c.first_broadcast && entries.size();
+
+	if ( slow )
+	{
+		i3c.first_broadcast	= false;
+		i3c.frequency( 0, 2000000, 2000000 );	//	I2C_freq = default, I3C_OD_freq = 2MHz, I3C_PP_freq = 2MHz
+	}
+
+	for ( auto& e : entries )
+	{
+		bool	stop	= (i++ == last) ? STOP : NO_STOP;
+		uint8_t	*dp		= e.dp ? e.dp : &e.data;
+
+		if ( BROADCAST_ADDR == e.targ )
+		{
+			uint8_t	bp[ REG_RW_BUFFER_SIZE ];
+
+			header		= -1;
+
+			if ( (e.length < 0) || ((int)sizeof( bp ) <= e.length) )
+			{
+				e.status	= kStatus_InvalidArgument;
+			}
+			else
+			{
+				bp[ 0 ]	= e.ccc;
+				memcpy( bp + 1, dp, e.length );
+
+				e.status	= i3c.xfer( kI3C_Write, i3c.ccc_type(), BROADCAST_ADDR, bp, e.length + 1, stop );
+			}
+		}
+		else
+		{
+			//	CCC header is command code, followed by defining byte if it is given
+			uint8_t	hp[ 2 ]	= { e.ccc, (uint8_t)e.defining_byte };
+			int		hl		= (NO_DEFINING_BYTE == e.defining_byte) ? 1 : 2;
+			int		key		= (e.ccc << 9) | ((hl - 1) << 8) | hp[ 1 ];
+
+			e.status	= kStatus_Success;
+
+			if ( header != key )
+			{
+				e.status	= i3c.xfer( kI3C_Write, i3c.ccc_type(), BROADCAST_ADDR, hp, hl, NO_STOP );
+				header		= key;
+			}
+
+			if ( kStatus_Success == e.status )
+				e.status	= i3c.xfer( e.dir, i3c.ccc_type(), e.targ, dp, e.length, stop );
+
+			if ( kStatus_Success != e.status )
+				header	= -1;
+		}
+
+		if ( (kStatus_Success == r) && (kStatus_Success != e.status) )
+			r	= e.status;
+	}
+
+	if ( slow )
+		i3c.frequency();	//	revert to default frequency
+
+	return r;
+}
+
+status_t I3C::CCCSequence::status( int index )
+{
+	return entries[ index ].status;
+}
+
+int I3C::CCCSequence::count( void )
+{
+	return entries.size();
+}
+
+void I3C::CCCSequence::clear( void )
+{
+	entries.clear();
+}
+
 int I3C::DAA( const uint8_t *address_list, uint8_t count, i3c_device_info_t** device_list )
 {
 	I3C_MasterProcessDAA( EXAMPLE_MASTER, (uint8_t *)address_list, count );
 
+	//	HDR capability is checked again for new addresses
+	memset( ddr_checked, 0, sizeof( ddr_checked ) );
+
 	uint8_t	devCount;
 	*device_list = I3C_MasterGetDeviceListAfterDAA( EXAMPLE_MASTER, &devCount );
 
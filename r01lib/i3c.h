@@ -27,17 +27,29 @@
 enum CCC
 {
 	BROADCAST_ENEC		= 0x00,
+	BROADCAST_DISEC		= 0x01,
 	BROADCAST_RSTDAA	= 0x06,
 	BROADCAST_ENTDAA	= 0x07,
+	BROADCAST_SETMWL	= 0x09,
+	BROADCAST_SETMRL	= 0x0A,
+	BROADCAST_ENTHDR0	= 0x20,
+	BROADCAST_RSTACT	= 0x2A,
+	BROADCAST_RSTGRPA	= 0x2C,
 	DIRECT_ENEC			= 0x80,
 	DIRECT_DICEC		= 0x81,
+	DIRECT_DISEC		= 0x81,
 	DIRECT_SETDASA		= 0x87,
 	DIRECT_SETNEWDA		= 0x88,
+	DIRECT_SETMWL		= 0x89,
+	DIRECT_SETMRL		= 0x8A,
 	DIRECT_GETPID		= 0x8D,
 	DIRECT_GETBCR		= 0x8E,
 	DIRECT_GETDCR		= 0x8F,
 	DIRECT_GETSTATUS	= 0x90,
-	DIRECT_RSTACT		= 0x90
+	DIRECT_RSTACT		= 0x9A,
+	DIRECT_GETCAPS		= 0x95,
+	DIRECT_SETGRPA		= 0x9B,
+	DIRECT_RSTGRPA		= 0x9C
 };
 
 typedef void (*i3c_func_ptr)(void); 
@@ -45,7 +57,9 @@ typedef void (*i3c_func_ptr)(void);
 class I3C : public I2C
 {
 public:
-	/** constants for mode setting  */
+	/** constants for mode setting
+	 *	in I3CDDR_MODE, register transfers are done in HDR-DDR for targets which support it and SDR for others
+	 */
 	enum MODE
 	{
 		I3C_MODE	= kI3C_TypeI3CSdr,
@@ -65,9 +79,30 @@ public:
 	enum MISC
 	{
 		BROADCAST_ADDR	= 0x7E,
-		PID_LENGTH		= 6
+		HOT_JOIN_ADDR	= 0x02,
+		PID_LENGTH		= 6,
+		BCR_HDR_CAPABLE	= 0x20,
+		CAPS_HDR_DDR	= 0x01,
+		DDR_READ_CMD	= 0x80,
+		IBI_PAYLOAD_SIZE	= 10,
+		IBI_QUEUE_DEPTH		= 16,
+		IBI_HANDLERS		= 16,
+		IBI_WON_RETRIES		= 3,
+		NO_DEFINING_BYTE	= -1
 	};
 
+	/** IBI event */
+	struct ibi_event
+	{
+		uint8_t		address;						/**< dynamic address of the target, HOT_JOIN_ADDR for Hot-Join */
+		uint8_t		mdb;							/**< mandatory data byte, 0 if no payload */
+		uint8_t		length;							/**< payload length including MDB */
+		uint8_t		payload[ IBI_PAYLOAD_SIZE ];	/**< payload */
+		uint32_t	time;							/**< us_count() at the IBI [us]. Keeps counting while the core sleeps */
+	};
+
+	using ibi_cb_ptr	= void (*)( const ibi_event& event, void *context );
+
 	/** Create an I3C instance with specified pins
 	 *
 	 * @param sda         pin number to connect SDA
@@ -125,7 +160,8 @@ public:
 	
 #ifdef	CUSTOM_REGISTAR_XFER
 	/** Register write (multiple byte data)
-	 *	provideds interface for register write
+	 *	provideds interface for register write.
+	 *	In I3CDDR_MODE, the register address is sent as HDR-DDR command code
 	 *	
 	 * @param targ target address
 	 * @param reg register address
@@ -133,10 +169,12 @@ public:
 	 * @param length data length
 	 * @return status_t
 	 */
-	virtual status_t	reg_write( uint8_t targ, uint8_t reg, const uint8_t *dp, int length, bool stop = STOP );
+	virtual status_t	reg_write( uint8_t targ, uint8_t reg, const uint8_t *dp, int length );
+	virtual status_t	reg_write( uint8_t targ, uint8_t reg, const uint8_t *dp, int length, bool stop );
 
 	/** Register read (multiple byte data)
-	 *	provideds interface for register read
+	 *	provideds interface for register read.
+	 *	In I3CDDR_MODE, the register address is sent as HDR-DDR command code
 	 *	
 	 * @param targ target address
 	 * @param reg register address
@@ -144,21 +182,126 @@ public:
 	 * @param length data length
 	 * @return status_t
 	 */
-	virtual status_t	reg_read( uint8_t targ, uint8_t reg, uint8_t *dp, int length, bool stop = STOP );
+	virtual status_t	reg_read( uint8_t targ, uint8_t reg, uint8_t *dp, int length );
+	virtual status_t	reg_read( uint8_t targ, uint8_t reg, uint8_t *dp, int length, bool stop );
 #endif	// CUSTOM_REGISTAR_XFER
+
+	/** HDR-DDR capability of target
+	 *	checked by GETBCR and GETCAPS CCCs at first call and kept until next DAA.
+	 *	A target which NACKed HDR-DDR transfer is marked as not capable
+	 *
+	 * @param targ target address
+	 * @return true if the target supports HDR-DDR
+	 */
+	virtual bool		hdr_ddr_capable( uint8_t targ );
+
+	/** Non-blocking transfer
+	 *	starts a transfer on the master handle and returns immediately.
+	 *	the callback is called in interrupt context when the transfer is done, with the result as status.
+	 *	blocking transfers return kStatus_I3C_Busy while a non-blocking transfer is ongoing.
+	 *	if an IBI wins the arbitration of the address header, the transfer is not done.
+	 *	the IBI is queued and the transfer is started again, up to IBI_WON_RETRIES times.
+	 *	kStatus_I3C_IBIWon is given to the callback if it still lost.
+	 *	a NACKed HDR-DDR transfer is started again in SDR and the target is marked as not HDR-DDR capable
+	 *
+	 * @param targ target address
+	 * @param dir I2C::WRITE or I2C::READ
+	 * @param dp data buffer. It needs to be kept available until the transfer completes
+	 * @param length data length
+	 * @param callback (option) function to be called at transfer completion
+	 * @param stop (option) generate STOP condition: "false" to make repeated-start in next transaction
+	 * @return status_t kStatus_Success if the transfer started
+	 */
+	virtual status_t	transfer_async( uint8_t targ, DIRECTION dir, uint8_t *dp, int length, xfer_cb_t callback = nullptr, bool stop = STOP );
+
+	/** Non-blocking register write
+	 *	register address is sent as subaddress of the transfer
+	 *
+	 * @param targ target address
+	 * @param reg register address
+	 * @param dp data to write. It needs to be kept available until the transfer completes
+	 * @param length data length
+	 * @param callback (option) function to be called at transfer completion
+	 * @return status_t kStatus_Success if the transfer started
+	 */
+	virtual status_t	reg_write_async( uint8_t targ, uint8_t reg, const uint8_t *dp, int length, xfer_cb_t callback = nullptr );
+
+	/** Non-blocking register read
+	 *	register address write and data read are done with repeated-START
+	 *
+	 * @param targ target address
+	 * @param reg register address
+	 * @param dp data buffer for read. It needs to be kept available until the transfer completes
+	 * @param length data length
+	 * @param callback (option) function to be called at transfer completion
+	 * @return status_t kStatus_Success if the transfer started
+	 */
+	virtual status_t	reg_read_async( uint8_t targ, uint8_t reg, uint8_t *dp, int length, xfer_cb_t callback = nullptr );
+
+	/** Non-blocking transfer state
+	 *
+	 * @return true if a non-blocking transfer is ongoing
+	 */
+	virtual bool		busy( void );
+
+	/** Wait non-blocking transfer completion
+	 *
+	 * @return status_t result of the last non-blocking transfer
+	 */
+	virtual status_t	transfer_wait( void );
 	
 	/** check IBI status
+	 *	takes one event from IBI queue
 	 *  
 	 * @return target address of IBI initiated device or zero if no event happened
 	 */
 	virtual uint8_t		check_IBI( void );
 	
 	/** set IBI callback function
+	 *	the function is called in interrupt context after the event is queued
 	 *  
 	 * @return target address of IBI initiated device or zero if no event happened
 	 */
 	virtual void		set_IBI_callback( i3c_func_ptr fp );
 
+	/** Read an IBI event
+	 *	IBIs are queued with payload and timestamp in interrupt context.
+	 *	The queue is lock-free single-producer (interrupt) / single-consumer
+	 *
+	 * @param event event
+	 * @return true if an event was read, false if queue is empty
+	 */
+	virtual bool		ibi_read( ibi_event& event );
+
+	/** Number of queued IBI events
+	 *
+	 * @return number of events
+	 */
+	virtual int			ibi_available( void );
+
+	/** Number of IBI events lost by queue full
+	 *
+	 * @return number of events
+	 */
+	virtual uint32_t	ibi_overruns( void );
+
+	/** Register IBI handler for a target
+	 *	the handler is called by ibi_dispatch(), so it can do I3C transfers
+	 *
+	 * @param address dynamic address of the target
+	 * @param func handler. nullptr to remove
+	 * @param context (option) pointer given to the handler
+	 * @return true if registered, false if handler table is full
+	 */
+	virtual bool		ibi_handler( uint8_t address, ibi_cb_ptr func, void *context = nullptr );
+
+	/** Call registered IBI handlers for queued events
+	 *	call this in main loop. Events from targets without handler are discarded
+	 *
+	 * @return number of events processed
+	 */
+	virtual int			ibi_dispatch( void );
+
 	/** CCC broadcast
 	 *  
 	 * @param ccc CCC command
@@ -204,21 +347,171 @@ public:
 	 */	
 	static void		master_callback( I3C_Type *base, i3c_master_handle_t *handle, status_t status, void *userData );
 
+	/** CCCSequence class
+	 *
+	 *  @class CCCSequence
+	 *
+	 *	A class to record broadcast and direct CCCs and send them in one framed sequence.
+	 *	CCCs are chained by repeated-START and a STOP condition is generated only at the end.
+	 *	Consecutive direct CCCs with same command code and defining byte share one CCC header, like SETMRL to multiple targets.
+	 *	A group address can be given as target of direct CCC.
+	 *	Baud rate for first broadcast is set only once for whole sequence.
+	 *	Data buffers given for recording need to be kept available until execute() is called.
+	 *	Recorded entries are kept after execute() so the same sequence can be performed repeatedly.
+	 *
+	 *	@code
+	 *	I3C::CCCSequence	seq( i3c );
+	 *	uint8_t				mrl[]	= { 0x00, 0x10 };
+	 *
+	 *	seq.broadcast( BROADCAST_DISEC, 0x01 );
+	 *	seq.direct_set( DIRECT_SETMRL, 0x08, mrl, sizeof( mrl ) );
+	 *	seq.direct_set( DIRECT_SETMRL, 0x09, mrl, sizeof( mrl ) );
+	 *	seq.broadcast( BROADCAST_ENEC, 0x01 );
+	 *	seq.execute();
+	 *	@endcode
+	 */
+	class CCCSequence
+	{
+	public:
+		/** Create a CCCSequence instance
+		 *
+		 * @param bus I3C instance to perform the CCCs
+		 */
+		CCCSequence( I3C& bus );
+
+		/** Destructor of CCCSequence
+		 */
+		virtual ~CCCSequence();
+
+		/** Record broadcast CCC
+		 *
+		 * @param ccc CCC command
+		 * @param dp (option) data to send
+		 * @param length (option) data length, up to (REG_RW_BUFFER_SIZE - 1). kStatus_InvalidArgument for longer
+		 * @return index of recorded entry
+		 */
+		int			broadcast( uint8_t ccc, const uint8_t *dp = nullptr, int length = 0 );
+
+		/** Record broadcast CCC (single byte data)
+		 *	data is copied into the sequence
+		 *
+		 * @param ccc CCC command
+		 * @param data data to send
+		 * @return index of recorded entry
+		 */
+		int			broadcast( uint8_t ccc, uint8_t data );
+
+		/** Record direct set CCC
+		 *
+		 * @param ccc CCC command
+		 * @param targ target address or group address
+		 * @param dp data to send
+		 * @param length data length
+		 * @param defining_byte (option) defining byte sent after the command code in the CCC header
+		 * @return index of recorded entry
+		 */
+		int			direct_set( uint8_t ccc, uint8_t targ, const uint8_t *dp, int length, int defining_byte = NO_DEFINING_BYTE );
+
+		/** Record direct set CCC (single byte data)
+		 *	data is copied into the sequence
+		 *
+		 * @param ccc CCC command
+		 * @param targ target address or group address
+		 * @param data data to send
+		 * @param defining_byte (option) defining byte sent after the command code in the CCC header
+		 * @return index of recorded entry
+		 */
+		int			direct_set( uint8_t ccc, uint8_t targ, uint8_t data, int defining_byte = NO_DEFINING_BYTE );
+
+		/** Record direct get CCC
+		 *
+		 * @param ccc CCC command
+		 * @param targ target address
+		 * @param dp data buffer for read
+		 * @param length data length
+		 * @param defining_byte (option) defining byte sent after the command code in the CCC header, like GETCAPS format 2
+		 * @return index of recorded entry
+		 */
+		int			direct_get( uint8_t ccc, uint8_t targ, uint8_t *dp, int length, int defining_byte = NO_DEFINING_BYTE );
+
+		/** Perform all recorded CCCs
+		 *	all entries are performed even if some of them failed
+		 *
+		 * @return status_t kStatus_Success if all entries succeeded, otherwise the first error
+		 */
+		status_t	execute( void );
+
+		/** Result of each entry
+		 *
+		 * @param index index of entry returned when it was recorded
+		 * @return status_t result of last execution
+		 */
+		status_t	status( int index );
+
+		/** Number of recorded entries
+		 *
+		 * @return number of entries
+		 */
+		int			count( void );
+
+		/** Clear all recorded entries
+		 */
+		void		clear( void );
+
+	private:
+		typedef struct	_entry {
+			uint8_t			ccc;
+			int				defining_byte;
+			uint8_t			targ;
+			i3c_direction_t	dir;
+			uint8_t			*dp;
+			int				length;
+			uint8_t			data;
+			status_t		status;
+		} entry;
+
+		I3C&				i3c;
+		std::vector<entry>	entries;
+	};
+
 protected:
 	using	I2C::ping;
 	using	I2C::scan;
 
+	status_t	stop_condition( void );
+
 private:
 	status_t	xfer( i3c_direction_t dir, i3c_bus_type_t type, uint8_t targ, uint8_t *dp, int length, bool stop = STOP );
 
 #ifdef	CUSTOM_REGISTAR_XFER
 	status_t 	reg_xfer( i3c_direction_t dir, i3c_bus_type_t type, uint8_t targ, uint8_t reg, uint8_t reg_length, uint8_t *dp, int length, bool stop = STOP );
 #endif	// CUSTOM_REGISTAR_XFER
+	i3c_bus_type_t	ccc_type( void );
+	i3c_bus_type_t	xfer_type( i3c_bus_type_t type, uint8_t targ, uint8_t reg, uint8_t reg_length, int length );
+	void		ddr_capable( uint8_t targ, bool capable );
+	status_t	xfer_async( i3c_direction_t dir, uint8_t targ, uint8_t reg, uint8_t reg_length, uint8_t *dp, int length, bool stop, xfer_cb_t callback );
+	void		async_done( status_t status );
 
 	i3c_bus_type_t								bus_type;
 	static const i3c_master_transfer_callback_t	masterCallback;
 	i3c_master_config_t							masterConfig;
 	bool										first_broadcast;
+
+	struct ibi_entry
+	{
+		uint8_t		address;
+		ibi_cb_ptr	func;
+		void		*context;
+	}											ibi_handlers[ IBI_HANDLERS ];
+
+	uint32_t									ddr_checked[ 4 ];
+	uint32_t									ddr_supported[ 4 ];
+
+	volatile bool								async_busy;
+	volatile status_t							async_status;
+	xfer_cb_t									async_cb;
+	i3c_master_transfer_t						async_xfer;
+	int											async_retries;
 };
 #else	// I3C_SUPPORTED
 #endif	// I3C_SUPPORTED
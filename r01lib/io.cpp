@@ -463,6 +463,139 @@ static gpio_pin pins[]	= {
 	{ 4, 30 },
 	{ 4, 31 },
 };
+#elif	CPU_HOST
+
+static gpio_pin pins[]	= {
+	{ DISABLED_GPIO, DISABLED_PIN },
+	{ 0,  0 },
+	{ 0,  1 },
+	{ 0,  2 },
+	{ 0,  3 },
+	{ 0,  4 },
+	{ 0,  5 },
+	{ 0,  6 },
+	{ 0,  7 },
+	{ 0,  8 },
+	{ 0,  9 },
+	{ 0, 10 },
+	{ 0, 11 },
+	{ 0, 12 },
+	{ 0, 13 },
+	{ 0, 14 },
+	{ 0, 15 },
+	{ 0, 16 },
+	{ 0, 17 },
+	{ 0, 18 },
+	{ 0, 19 },
+	{ 0, 20 },
+	{ 0, 21 },
+	{ 0, 22 },
+	{ 0, 23 },
+	{ 0, 24 },
+	{ 0, 25 },
+	{ 0, 26 },
+	{ 0, 27 },
+	{ 0, 28 },
+	{ 0, 29 },
+	{ 0, 30 },
+	{ 0, 31 },
+	{ 1,  0 },
+	{ 1,  1 },
+	{ 1,  2 },
+	{ 1,  3 },
+	{ 1,  4 },
+	{ 1,  5 },
+	{ 1,  6 },
+	{ 1,  7 },
+	{ 1,  8 },
+	{ 1,  9 },
+	{ 1, 10 },
+	{ 1, 11 },
+	{ 1, 12 },
+	{ 1, 13 },
+	{ 1, 14 },
+	{ 1, 15 },
+	{ 1, 16 },
+	{ 1, 17 },
+	{ 1, 18 },
+	{ 1, 19 },
+	{ 1, 20 },
+	{ 1, 21 },
+	{ 1, 22 },
+	{ 1, 23 },
+	{ 1, 24 },
+	{ 1, 25 },
+	{ 1, 26 },
+	{ 1, 27 },
+	{ 1, 28 },
+	{ 1, 29 },
+	{ 1, 30 },
+	{ 1, 31 },
+	{ 2,  0 },
+	{ 2,  1 },
+	{ 2,  2 },
+	{ 2,  3 },
+	{ 2,  4 },
+	{ 2,  5 },
+	{ 2,  6 },
+	{ 2,  7 },
+	{ 2,  8 },
+	{ 2,  9 },
+	{ 2, 10 },
+	{ 2, 11 },
+	{ 2, 12 },
+	{ 2, 13 },
+	{ 2, 14 },
+	{ 2, 15 },
+	{ 2, 16 },
+	{ 2, 17 },
+	{ 2, 18 },
+	{ 2, 19 },
+	{ 2, 20 },
+	{ 2, 21 },
+	{ 2, 22 },
+	{ 2, 23 },
+	{ 2, 24 },
+	{ 2, 25 },
+	{ 2, 26 },
+	{ 2, 27 },
+	{ 2, 28 },
+	{ 2, 29 },
+	{ 2, 30 },
+	{ 2, 31 },
+	{ 3,  0 },
+	{ 3,  1 },
+	{ 3,  2 },
+	{ 3,  3 },
+	{ 3,  4 },
+	{ 3,  5 },
+	{ 3,  6 },
+	{ 3,  7 },
+	{ 3,  8 },
+	{ 3,  9 },
+	{ 3, 10 },
+	{ 3, 11 },
+	{ 3, 12 },
+	{ 3, 13 },
+	{ 3, 14 },
+	{ 3, 15 },
+	{ 3, 16 },
+	{ 3, 17 },
+	{ 3, 18 },
+	{ 3, 19 },
+	{ 3, 20 },
+	{ 3, 21 },
+	{ 3, 22 },
+	{ 3, 23 },
+	{ 3, 24 },
+	{ 3, 25 },
+	{ 3, 26 },
+	{ 3, 27 },
+	{ 3, 28 },
+	{ 3, 29 },
+	{ 3, 30 },
+	{ 3, 31 },
+};
 #else
 #error Target CPU is not supported
 #endif // CPU_MCXN947VDF
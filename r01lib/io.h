@@ -755,6 +755,197 @@ enum {
 	#define	PIN_LED_OFF	true
 	#define	PIN_LED_ON	false
 
+#elif	CPU_HOST
+/*	pin number on host is "1 + port * 32 + bit" (host/host_sim.cpp depends on this)	*/
+enum {
+	DISABLED_PIN,
+	P0_0,
+	P0_1,
+	P0_2,
+	P0_3,
+	P0_4,
+	P0_5,
+	P0_6,
+	P0_7,
+	P0_8,
+	P0_9,
+	P0_10,
+	P0_11,
+	P0_12,
+	P0_13,
+	P0_14,
+	P0_15,
+	P0_16,
+	P0_17,
+	P0_18,
+	P0_19,
+	P0_20,
+	P0_21,
+	P0_22,
+	P0_23,
+	P0_24,
+	P0_25,
+	P0_26,
+	P0_27,
+	P0_28,
+	P0_29,
+	P0_30,
+	P0_31,
+	P1_0,
+	P1_1,
+	P1_2,
+	P1_3,
+	P1_4,
+	P1_5,
+	P1_6,
+	P1_7,
+	P1_8,
+	P1_9,
+	P1_10,
+	P1_11,
+	P1_12,
+	P1_13,
+	P1_14,
+	P1_15,
+	P1_16,
+	P1_17,
+	P1_18,
+	P1_19,
+	P1_20,
+	P1_21,
+	P1_22,
+	P1_23,
+	P1_24,
+	P1_25,
+	P1_26,
+	P1_27,
+	P1_28,
+	P1_29,
+	P1_30,
+	P1_31,
+	P2_0,
+	P2_1,
+	P2_2,
+	P2_3,
+	P2_4,
+	P2_5,
+	P2_6,
+	P2_7,
+	P2_8,
+	P2_9,
+	P2_10,
+	P2_11,
+	P2_12,
+	P2_13,
+	P2_14,
+	P2_15,
+	P2_16,
+	P2_17,
+	P2_18,
+	P2_19,
+	P2_20,
+	P2_21,
+	P2_22,
+	P2_23,
+	P2_24,
+	P2_25,
+	P2_26,
+	P2_27,
+	P2_28,
+	P2_29,
+	P2_30,
+	P2_31,
+	P3_0,
+	P3_1,
+	P3_2,
+	P3_3,
+	P3_4,
+	P3_5,
+	P3_6,
+	P3_7,
+	P3_8,
+	P3_9,
+	P3_10,
+	P3_11,
+	P3_12,
+	P3_13,
+	P3_14,
+	P3_15,
+	P3_16,
+	P3_17,
+	P3_18,
+	P3_19,
+	P3_20,
+	P3_21,
+	P3_22,
+	P3_23,
+	P3_24,
+	P3_25,
+	P3_26,
+	P3_27,
+	P3_28,
+	P3_29,
+	P3_30,
+	P3_31,
+};
+
+	#define	D0		P0_0
+	#define	D1		P0_1
+	#define	D2		P0_2
+	#define	D3		P0_3
+	#define	D4		P0_4
+	#define	D5		P0_5
+	#define	D6		P0_6
+	#define	D7		P0_7
+	#define	D8		P0_8
+	#define	D9		P0_9
+	#define	D10		P0_10
+	#define	D11		P0_11
+	#define	D12		P0_12
+	#define	D13		P0_13
+	#define	D18		P0_18
+	#define	D19		P0_19
+	#define	A0		P1_0
+	#define	A1		P1_1
+	#define	A2		P1_2
+	#define	A3		P1_3
+	#define	A4		P1_4
+	#define	A5		P1_5
+	#define	SW2		P1_6
+	#define	SW3		P1_7
+	#define	MB_AN	P2_0
+	#define	MB_RST	P2_1
+	#define	MB_CS	P2_2
+	#define	MB_SCK	P2_3
+	#define	MB_MISO	P2_4
+	#define	MB_MOSI	P2_5
+	#define	MB_PWM	P2_6
+	#define	MB_INT	P2_7
+	#define	MB_RX	P2_8
+	#define	MB_TX	P2_9
+	#define	MB_SCL	P2_10
+	#define	MB_SDA	P2_11
+	#define	RED		P3_0
+	#define	GREEN	P3_1
+	#define	BLUE	P3_2
+
+	#define	I2C_SDA		D18
+	#define	I2C_SCL		D19
+	#define	SPI_CS		D10
+	#define	SPI_MOSI	D11
+	#define	SPI_MISO	D12
+	#define	SPI_SCLK	D13
+	#define	ARD_CS		SPI_CS
+	#define	ARD_MOSI	SPI_MOSI
+	#define	ARD_MISO	SPI_MISO
+	#define	ARD_SCK		SPI_SCLK
+
+	#define	USBTX		P3_4
+	#define	USBRX		P3_3
+
+	#define	PIN_LED_OFF	true
+	#define	PIN_LED_ON	false
+
 #else
 #error Target CPU is not supported
 #endif // CPU_MCXN947VDF
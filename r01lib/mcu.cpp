@@ -15,9 +15,14 @@ extern "C" {
 
 #if	CPU_MCXC444VLH
 	#include "fsl_i2c.h"
+	#include "fsl_pit.h"
+#elif	CPU_HOST
+	#include "fsl_utick.h"
+	#include "fsl_ostimer.h"
 #else
 	#include "fsl_reset.h"
 	#include "fsl_utick.h"
+	#include "fsl_ostimer.h"
 	#include "fsl_i3c.h"
 	#include "fsl_lpi2c.h"
 #endif
@@ -27,6 +32,10 @@ extern "C" {
 #include "obj.h"
 #include "io.h"
 
+#ifdef	CPU_HOST
+	#include "host_sim.h"
+#endif
+
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wprio-ctor-dtor"
 __attribute__((constructor(0)))
@@ -62,6 +71,7 @@ void init_mcu( void )
 	CLOCK_AttachClk(kFRO12M_to_FLEXCOMM1);
 
 	SYSCON->CLOCK_CTRL |= SYSCON_CLOCK_CTRL_FRO1MHZ_ENA_MASK;	//	UTICK
+	CLOCK_AttachClk( kCLK_1M_to_OSTIMER );						//	Ticker timebase
 
 	CLOCK_EnableClock( kCLOCK_Gpio0 );
 	CLOCK_EnableClock( kCLOCK_Gpio1 );
@@ -95,6 +105,7 @@ void init_mcu( void )
 	CLOCK_AttachClk(kFRO12M_to_FLEXCOMM3);
 
 	SYSCON->CLOCK_CTRL |= SYSCON_CLOCK_CTRL_FRO1MHZ_ENA_MASK;	//	UTICK
+	CLOCK_AttachClk( kCLK_1M_to_OSTIMER );						//	Ticker timebase
 
 	CLOCK_EnableClock( kCLOCK_Gpio0 );
 	CLOCK_EnableClock( kCLOCK_Gpio1 );
@@ -151,6 +162,8 @@ void init_mcu( void )
 	CLOCK_EnableClock( kCLOCK_GateGPIO4 );
 
 	RESET_PeripheralReset( kUTICK0_RST_SHIFT_RSTn );
+	CLOCK_AttachClk( kCLK_1M_to_OSTIMER );		//	Ticker timebase
+	RESET_PeripheralReset( kOSTIMER0_RST_SHIFT_RSTn );
 	
 	BOARD_InitPins();
 	BOARD_InitBootClocks();
@@ -176,6 +189,8 @@ void init_mcu( void )
 	CLOCK_EnableClock( kCLOCK_GateGPIO3 );
 
 	RESET_PeripheralReset( kUTICK0_RST_SHIFT_RSTn );
+	CLOCK_AttachClk( kCLK_1M_to_OSTIMER );		//	Ticker timebase
+	RESET_PeripheralReset( kOSTIMER0_RST_SHIFT_RSTn );
 	
 	BOARD_InitPins();
 	BOARD_InitBootClocks();
@@ -200,6 +215,12 @@ void init_mcu( void )
 #endif // (defined(SDK_DEBUGCONSOLE) && (SDK_DEBUGCONSOLE == DEBUGCONSOLE_REDIRECT_TO_SDK))
 
 
+#elif	CPU_HOST
+	/* board functions are empty on host. Buses, pins and time are simulated (host/host_sim.h) */
+	BOARD_InitBootPins();
+	BOARD_InitBootClocks();
+	BOARD_InitDebugConsole();
+
 #else
 	#error Not supported CPU
 	
@@ -207,6 +228,43 @@ void init_mcu( void )
 
 #ifndef	CPU_MCXC444VLH
 	UTICK_Init( UTICK0 );
+	OSTIMER_Init( OSTIMER0 );
+#else
+	pit_config_t	pit_config;		//	us_count timebase: CH0 makes 1 MHz ticks, CH1 counts them
+
+	PIT_GetDefaultConfig( &pit_config );
+	PIT_Init( PIT, &pit_config );
+	PIT_SetTimerPeriod( PIT, kPIT_Chnl_0, CLOCK_GetBusClkFreq() / 1000000UL );
+	PIT->CHANNEL[ kPIT_Chnl_1 ].LDVAL	= 0xFFFFFFFFUL;	//	full 32 bit wrap. PIT_SetTimerPeriod() loads count - 1
+	PIT_SetTimerChainMode( PIT, kPIT_Chnl_1, true );
+	PIT_StartTimer( PIT, kPIT_Chnl_1 );
+	PIT_StartTimer( PIT, kPIT_Chnl_0 );
+#endif
+
+#if	!defined( CPU_MCXC444VLH ) && !defined( CPU_HOST )
+	CoreDebug->DEMCR	|= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT			 = 0;
+	DWT->CTRL			|= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+uint32_t cycle_count( void )
+{
+#if		CPU_MCXC444VLH
+	return 0;
+#elif	CPU_HOST
+	return (uint32_t)(SimClock::core_ns() * (CLOCK_GetCoreSysClkFreq() / 1000000ULL) / 1000ULL);
+#else
+	return DWT->CYCCNT;
+#endif
+}
+
+uint32_t us_count( void )
+{
+#if		CPU_MCXC444VLH
+	return ~PIT_GetCurrentTimerCount( PIT, kPIT_Chnl_1 );	//	CH1 counts down from 0xFFFFFFFF
+#else
+	return (uint32_t)OSTIMER_GetCurrentTimerValue( OSTIMER0 );
 #endif
 }
 
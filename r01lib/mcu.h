@@ -15,5 +15,25 @@ void	wait_ms( unsigned int milloseconds );
 void	wait_us( unsigned int microseconds );
 void 	panic( const char *s );
 
+/** CPU cycle counter
+ *
+ *	Free running counter at core clock (DWT CYCCNT). Wraps around at 32 bits.
+ *	It stops while the core sleeps in WFI, so it is for short intervals. Use Ticker::now_us() for time.
+ *	Always 0 on MCXC444 since Cortex-M0+ has no cycle counter.
+ *
+ * @return cycle count
+ */
+uint32_t	cycle_count( void );
+
+/** Micro-second counter
+ *
+ *	Free running counter at 1 MHz. Wraps around at 32 bits.
+ *	Unlike cycle_count(), it keeps counting while the core sleeps in WFI, so it is for timestamps and intervals across sleep.
+ *	OSTIMER on MCXN/MCXA, chained PIT channels on MCXC444.
+ *
+ * @return micro-seconds
+ */
+uint32_t	us_count( void );
+
 
 #endif // R01LIB_MCU_H
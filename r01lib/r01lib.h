@@ -23,7 +23,7 @@ extern "C" {
 #define		SEMIHOST_OPERATION
 #endif
 
-#ifdef	CPU_MCXC444VLH
+#if defined( CPU_MCXC444VLH ) || defined( CPU_HOST )
 #else
 #define		I3C_SUPPORTED
 #endif
@@ -36,6 +36,9 @@ extern "C" {
 #include	"InterruptIn.h"
 #include	"BusInOut.h"
 #include	"Serial.h"
+#include	"SerialFramer.h"
+#include	"EventQueue.h"
+#include	"Coroutine.h"
 #include	"mcu.h"
 
 #endif // R01LIB_R01LIB_H
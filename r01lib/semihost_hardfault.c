@@ -46,7 +46,7 @@
 // ****************************************************************************
 
 // Allow handler to be removed by setting a define (via command line)
-#if !defined (__SEMIHOST_HARDFAULT_DISABLE)
+#if !defined (__SEMIHOST_HARDFAULT_DISABLE) && !defined (CPU_HOST)
 
 __attribute__((naked))
 void HardFault_Handler(void){
@@ -28,7 +28,9 @@ extern "C" {
 #define EXAMPLE_SPI_MASTER_SOURCE_CLOCK kCLOCK_BusClk
 #define EXAMPLE_SPI_MASTER_CLK_FREQ     CLOCK_GetFreq( kCLOCK_BusClk )
 
-SPI::SPI( int mosi, int miso, int sclk, int cs ) : Obj( true ), chip_select( cs )
+SPI::SPI( int mosi, int miso, int sclk, int cs )
+	: Obj( true ), chip_select( cs ),
+	  async_handle_ready( false ), async_busy( false ), async_status( kStatus_Success )
 {
 	unit_base			= EXAMPLE_SPI_MASTER;
 	master_clk_freq		= EXAMPLE_SPI_MASTER_CLK_FREQ;
@@ -59,6 +61,9 @@ SPI::SPI( int mosi, int miso, int sclk, int cs ) : Obj( true ), chip_select( cs
 
 SPI::~SPI()
 {
+	if ( async_busy )
+		SPI_MasterTransferAbort( unit_base, &async_handle );
+
 	SPI_Deinit( unit_base );
 }
 
@@ -84,6 +89,9 @@ status_t SPI::write( uint8_t *wp, uint8_t *rp, int length )
 	spi_transfer_t	masterXfer;
 	status_t		status;
 
+	if ( async_busy )
+		return kStatus_SPI_Busy;
+
 	masterXfer.txData		= wp;
 	masterXfer.rxData		= rp;
 	masterXfer.dataSize		= length;
@@ -99,9 +107,79 @@ status_t SPI::write( uint8_t *wp, uint8_t *rp, int length )
 	return status;
 }
 
+status_t SPI::transfer_async( const uint8_t *wp, uint8_t *rp, int length, xfer_cb_t callback )
+{
+	if ( async_busy )
+		return kStatus_SPI_Busy;
+
+	if ( !async_handle_ready )
+	{
+		SPI_MasterTransferCreateHandle( unit_base, &async_handle, async_callback, this );
+		async_handle_ready	= true;
+	}
+
+	spi_transfer_t	masterXfer;
+
+	masterXfer.txData		= (uint8_t *)wp;
+	masterXfer.rxData		= rp;
+	masterXfer.dataSize		= length;
+	masterXfer.flags		= 0;
+
+	async_cb	= callback;
+	async_busy	= true;
+
+	if ( !manual_cs_control )
+		chip_select	= false;
+
+	status_t	r	= SPI_MasterTransferNonBlocking( unit_base, &async_handle, &masterXfer );
+
+	if ( kStatus_Success != r )
+	{
+		if ( !manual_cs_control )
+			chip_select	= true;
+
+		async_busy	= false;
+	}
+
+	return r;
+}
+
+void SPI::async_callback( SPI_Type *base, spi_master_handle_t *handle, status_t status, void *userData )
+{
+	SPI	*spi	= (SPI *)userData;
+
+	if ( !spi->manual_cs_control )
+		spi->chip_select	= true;
+
+	spi->async_done( status );
+}
+
+status_t SPI::write_frames( uint8_t *wp, uint8_t *rp, int length, int frame_length )
+{
+	status_t	status	= kStatus_Success;
+
+	if ( (frame_length < 1) || (length % frame_length) )
+		return kStatus_InvalidArgument;
+
+	for ( int i = 0; (i < length) && (kStatus_Success == status); i += frame_length )
+	{
+		//	write() does not touch chip-select in manual mode
+		if ( manual_cs_control )
+			chip_select	= false;
+
+		status	= write( wp + i, rp ? rp + i : nullptr, frame_length );
+
+		if ( manual_cs_control )
+			chip_select	= true;
+	}
+
+	return status;
+}
+
 DigitalOut* SPI::cs_manual_control( bool flag )
 {
-	chip_select	= true;
+	manual_cs_control	= flag;
+	chip_select			= true;
 	
 	return &chip_select;
 }
@@ -145,11 +223,23 @@ DigitalOut* SPI::cs_manual_control( bool flag )
 	#define EXAMPLE_LPSPI_MASTER_PCS_FOR_INIT     (kLPSPI_Pcs1)
 	#define EXAMPLE_LPSPI_MASTER_PCS_FOR_TRANSFER (kLPSPI_MasterPcs1)
 	#define EXAMPLE_LPSPI_MASTER_IRQHandler       (LPSPI1_IRQHandler)
+#elif	CPU_HOST
+	#define EXAMPLE_LPSPI_MASTER_BASEADDR0			(LPSPI0)
+	#define LPSPI_MASTER_CLK_FREQ0					(CLOCK_GetLpspiClkFreq(0))
+	#define EXAMPLE_LPSPI_MASTER_PCS_FOR_INIT0		(kLPSPI_Pcs0)
+	#define EXAMPLE_LPSPI_MASTER_PCS_FOR_TRANSFER0	(kLPSPI_MasterPcs0)
+
+	#define EXAMPLE_LPSPI_MASTER_BASEADDR1			(LPSPI1)
+	#define LPSPI_MASTER_CLK_FREQ1					(CLOCK_GetLpspiClkFreq(1))
+	#define EXAMPLE_LPSPI_MASTER_PCS_FOR_INIT1		(kLPSPI_Pcs0)
+	#define EXAMPLE_LPSPI_MASTER_PCS_FOR_TRANSFER1	(kLPSPI_MasterPcs0)
 #else
 	#error Not supported CPU
 #endif
 
-SPI::SPI( int mosi, int miso, int sclk, int cs ) : Obj( true ), chip_select( cs )
+SPI::SPI( int mosi, int miso, int sclk, int cs )
+	: Obj( true ), chip_select( cs ),
+	  async_handle_ready( false ), async_busy( false ), async_status( kStatus_Success )
 {
 #ifdef	CPU_MCXN947VDF
 #elif	CPU_MCXN236VDF
@@ -182,6 +272,25 @@ SPI::SPI( int mosi, int miso, int sclk, int cs ) : Obj( true ), chip_select( cs
 	{
 		panic( "FRDM-MCXA156 SPI on Arduino pin and MikroBus are supported. To use Arduino pins, change jumper setting (short 2-3 pins on R59 and R60) and use \"ARD_MOSI\" and \"ARD_CS\" keywords instead of D10 and D11." );
 	}
+#elif	CPU_HOST
+	if ( (mosi == SPI_MOSI) && (miso == SPI_MISO) && (sclk == SPI_SCLK) && (cs == SPI_CS) )
+	{
+		unit_base			= EXAMPLE_LPSPI_MASTER_BASEADDR0;
+		master_clk_freq		= LPSPI_MASTER_CLK_FREQ0;
+		master_pcs_for_init	= EXAMPLE_LPSPI_MASTER_PCS_FOR_INIT0;
+		master_pcs_4_xfer	= EXAMPLE_LPSPI_MASTER_PCS_FOR_TRANSFER0;
+	}
+	else if ( (mosi == MB_MOSI) && (miso == MB_MISO) && (sclk == MB_SCK) && (cs == MB_CS) )
+	{
+		unit_base			= EXAMPLE_LPSPI_MASTER_BASEADDR1;
+		master_clk_freq		= LPSPI_MASTER_CLK_FREQ1;
+		master_pcs_for_init	= EXAMPLE_LPSPI_MASTER_PCS_FOR_INIT1;
+		master_pcs_4_xfer	= EXAMPLE_LPSPI_MASTER_PCS_FOR_TRANSFER1;
+	}
+	else
+	{
+		panic( "HOST supports SPI on Arduino pins (D10~D13) or MikroBus pins" );
+	}
 #else
 	unit_base			= EXAMPLE_LPSPI_MASTER_BASEADDR;
 	master_clk_freq		= LPSPI_MASTER_CLK_FREQ;
@@ -221,6 +330,9 @@ SPI::SPI( int mosi, int miso, int sclk, int cs ) : Obj( true ), chip_select( cs
 
 SPI::~SPI()
 {
+	if ( async_busy )
+		LPSPI_MasterTransferAbort( unit_base, &async_handle );
+
 	LPSPI_Deinit( unit_base );
 }
 
@@ -249,18 +361,116 @@ status_t SPI::write( uint8_t *wp, uint8_t *rp, int length )
 {
 	lpspi_transfer_t	masterXfer;
 
+	if ( async_busy )
+		return kStatus_LPSPI_Busy;
+
 	masterXfer.txData		= wp;
 	masterXfer.rxData		= rp;
 	masterXfer.dataSize		= length;
 	masterXfer.configFlags	= master_pcs_4_xfer | kLPSPI_MasterPcsContinuous | kLPSPI_MasterByteSwap;
 
+	frame_bits( 8 );
+
 	return LPSPI_MasterTransferBlocking( unit_base, &masterXfer );
 }
 
+status_t SPI::write_frames( uint8_t *wp, uint8_t *rp, int length, int frame_length )
+{
+	lpspi_transfer_t	masterXfer;
+	status_t			status	= kStatus_Success;
+
+	if ( (frame_length < 1) || (max_frame_length < frame_length) || (length % frame_length) )
+		return kStatus_InvalidArgument;
+
+	if ( async_busy )
+		return kStatus_LPSPI_Busy;
+
+	if ( manual_cs_control )
+	{
+		//	hardware PCS is not on the pin. chip-select is toggled by software for each frame
+		for ( int i = 0; (i < length) && (kStatus_Success == status); i += frame_length )
+		{
+			chip_select	= false;
+			status		= write( wp + i, rp ? rp + i : nullptr, frame_length );
+			chip_select	= true;
+		}
+
+		return status;
+	}
+
+	frame_bits( frame_length * 8 );
+
+	//	LPSPI driver takes frames longer than 4 bytes as a stream only if they are multiple of 4 bytes
+	int	chunk	= ((4 < frame_length) && (frame_length % 4)) ? frame_length : length;
+
+	for ( int i = 0; (i < length) && (kStatus_Success == status); i += chunk )
+	{
+		masterXfer.txData		= wp + i;
+		masterXfer.rxData		= rp ? rp + i : nullptr;
+		masterXfer.dataSize		= chunk;
+		masterXfer.configFlags	= master_pcs_4_xfer | kLPSPI_MasterByteSwap;
+
+		status	= LPSPI_MasterTransferBlocking( unit_base, &masterXfer );
+	}
+
+	return status;
+}
+
+void SPI::frame_bits( uint32_t bits )
+{
+	if ( masterConfig.bitsPerFrame == bits )
+		return;
+
+	//	kept in config for re-initialization by frequency() and mode()
+	masterConfig.bitsPerFrame	= bits;
+
+	//	frame size is in TCR only. the module is not re-initialized
+	unit_base->TCR	= (unit_base->TCR & ~LPSPI_TCR_FRAMESZ_MASK) | LPSPI_TCR_FRAMESZ( bits - 1 );
+}
+
+status_t SPI::transfer_async( const uint8_t *wp, uint8_t *rp, int length, xfer_cb_t callback )
+{
+	if ( async_busy )
+		return kStatus_LPSPI_Busy;
+
+	if ( !async_handle_ready )
+	{
+		LPSPI_MasterTransferCreateHandle( unit_base, &async_handle, async_callback, this );
+		async_handle_ready	= true;
+	}
+
+	lpspi_transfer_t	masterXfer;
+
+	masterXfer.txData		= wp;
+	masterXfer.rxData		= rp;
+	masterXfer.dataSize		= length;
+	masterXfer.configFlags	= master_pcs_4_xfer | kLPSPI_MasterPcsContinuous | kLPSPI_MasterByteSwap;
+
+	frame_bits( 8 );
+
+	async_cb	= callback;
+	async_busy	= true;
+
+	status_t	r	= LPSPI_MasterTransferNonBlocking( unit_base, &async_handle, &masterXfer );
+
+	if ( kStatus_Success != r )
+		async_busy	= false;
+
+	return r;
+}
+
+void SPI::async_callback( LPSPI_Type *base, lpspi_master_handle_t *handle, status_t status, void *userData )
+{
+	((SPI *)userData)->async_done( status );
+}
+
 DigitalOut* SPI::cs_manual_control( bool flag )
 {
-	chip_select.pin_mux( flag ? 0 : 2 );
+	manual_cs_control	= flag;
+
+	//	output level is set before switching to GPIO to avoid a glitch on chip-select
 	chip_select	= true;
+	chip_select.pin_mux( flag ? 0 : 2 );
 	
 	return &chip_select;
 }
@@ -268,3 +478,91 @@ DigitalOut* SPI::cs_manual_control( bool flag )
 
 #endif // CPU_MCXC444VLH
 
+status_t SPI::transfer( uint8_t *dp, int length )
+{
+	return write( dp, dp, length );
+}
+
+bool SPI::busy( void )
+{
+	return async_busy;
+}
+
+status_t SPI::transfer_wait( void )
+{
+	while ( true )
+	{
+		//	sleep with interrupts masked to not miss the completion right before WFI
+		uint32_t	primask	= DisableGlobalIRQ();
+		bool		done	= !async_busy;
+
+		if ( !done )
+			__WFI();
+
+		EnableGlobalIRQ( primask );
+
+		if ( done )
+			break;
+	}
+
+	return async_status;
+}
+
+void SPI::async_done( status_t status )
+{
+	if ( !async_busy )
+		return;
+
+	//	callback can start next transfer
+	xfer_cb_t	cb	= std::move( async_cb );
+
+	async_cb		= nullptr;
+	async_status	= status;
+	last_status		= status;
+	async_busy		= false;
+
+	if ( cb )
+		cb( status );
+}
+
+SPI::DoubleBuffer::DoubleBuffer( SPI& spi, int size ) : _spi( spi ), _size( size ), _index( 0 )
+{
+	for ( int i = 0; i < 2; i++ )
+	{
+		_tx[ i ].resize( size );
+		_rx[ i ].resize( size );
+	}
+}
+
+SPI::DoubleBuffer::~DoubleBuffer()
+{
+	_spi.transfer_wait();
+}
+
+uint8_t* SPI::DoubleBuffer::tx( void )
+{
+	return _tx[ _index ].data();
+}
+
+const uint8_t* SPI::DoubleBuffer::rx( void )
+{
+	_spi.transfer_wait();
+
+	return _rx[ _index ^ 1 ].data();
+}
+
+status_t SPI::DoubleBuffer::send( int length, xfer_cb_t callback )
+{
+	if ( _size < length )
+		return kStatus_InvalidArgument;
+
+	_spi.transfer_wait();
+
+	status_t	r	= _spi.transfer_async( _tx[ _index ].data(), _rx[ _index ].data(), length, callback );
+
+	if ( kStatus_Success == r )
+		_index	^= 1;
+
+	return r;
+}
+
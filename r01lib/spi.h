@@ -15,6 +15,9 @@ extern "C" {
 #endif
 }
 
+#include	<functional>
+#include	<vector>
+
 #include	"spi.h"
 #include	"io.h"
 
@@ -31,6 +34,12 @@ extern "C" {
 class SPI : public Obj
 {
 public:
+
+	/** defining callback for non-blocking transfer completion	*/
+	using xfer_cb_t	= std::function<void( status_t status )>;
+
+	/** Maximum frame length for write_frames() in bytes (LPSPI frame size is up to 4096 bits) */
+	constexpr static int	max_frame_length	= 512;
 	
 	/** Create a SPI instance with specified pins
 	 *
@@ -67,9 +76,59 @@ public:
 	 * @param wp data to write
 	 * @param rp data buffer for read
 	 * @param length transfer length
+	 * @return status_t. busy status while a non-blocking transfer is ongoing
 	 */	
 	virtual status_t		write( uint8_t *wp, uint8_t *rp, int length );
 
+	/** In-place data transfer on SPI
+	 *	full-duplex transfer which overwrites write data by read data.
+	 *	no temporary buffer is needed because each byte is sent before a byte is received into same position
+	 *  
+	 * @param dp data to write and buffer for read
+	 * @param length transfer length
+	 */	
+	virtual status_t		transfer( uint8_t *dp, int length );
+
+	/** Data transfer on SPI with chip-select toggled for each frame
+	 *	multiple short commands are sent by one call. on LPSPI, the frames are sent by hardware PCS control 
+	 *	without CPU intervention between frames. on MCXC444 and with manual CS control (cs_manual_control()), 
+	 *	frames are sent one by one with chip-select toggled by software.
+	 *	read buffer can be same as write buffer. 
+	 *	frames longer than 4 bytes are sent in one transfer if they are multiple of 4 bytes, otherwise one transfer per frame 
+	 *	(LPSPI driver limitation). data is sent in memory order in either case.
+	 *  
+	 * @param wp data to write
+	 * @param rp data buffer for read
+	 * @param length transfer length. it needs to be multiple of frame_length
+	 * @param frame_length bytes per frame (1 ~ max_frame_length)
+	 */	
+	virtual status_t		write_frames( uint8_t *wp, uint8_t *rp, int length, int frame_length );
+
+	/** Non-blocking data transfer on SPI
+	 *	starts a transfer and returns immediately.
+	 *	the transfer is performed by interrupt and the callback is called in interrupt context when it is done.
+	 *	no data copy is done: both buffers are owned by caller and need to be kept available until the transfer completes
+	 *  
+	 * @param wp data to write
+	 * @param rp data buffer for read. nullptr if the read data is not needed
+	 * @param length transfer length
+	 * @param callback (option) function to be called at transfer completion
+	 * @return status_t kStatus_Success if the transfer started
+	 */	
+	virtual status_t		transfer_async( const uint8_t *wp, uint8_t *rp, int length, xfer_cb_t callback = nullptr );
+
+	/** Non-blocking transfer state
+	 *
+	 * @return true if a non-blocking transfer is ongoing
+	 */
+	virtual bool			busy( void );
+
+	/** Wait non-blocking transfer completion
+	 *
+	 * @return status_t result of the last non-blocking transfer
+	 */
+	virtual status_t		transfer_wait( void );
+
 	/** Manual CS control setting
 	 *
 	 * @param flag manual setting = true, auto control = false
@@ -79,20 +138,97 @@ public:
 	/** variable for reporting last state */
 	status_t				last_status;
 
+	/** DoubleBuffer class
+	 *
+	 *  @class DoubleBuffer
+	 *
+	 *	Ping-pong buffers for non-blocking transfers.
+	 *	While a buffer is transferred, next data can be prepared in another buffer.
+	 *
+	 *	Example:
+	 *	@code
+	 *	SPI::DoubleBuffer	db( spi, 64 );
+	 *
+	 *	while ( true )
+	 *	{
+	 *		prepare_frame( db.tx() );	//	filling next buffer while previous one is on the bus
+	 *		db.send( 64 );
+	 *	}
+	 *	@endcode
+	 */
+	class DoubleBuffer
+	{
+	public:
+		/** Create a DoubleBuffer instance
+		 *
+		 * @param spi SPI instance
+		 * @param size size of each buffer
+		 */
+		DoubleBuffer( SPI& spi, int size );
+		virtual ~DoubleBuffer();
+
+		/** Not copyable. A transfer in progress points to the buffers */
+		DoubleBuffer( const DoubleBuffer& )				= delete;
+		DoubleBuffer&	operator=( const DoubleBuffer& )	= delete;
+
+		/** Buffer to prepare next transfer data
+		 *
+		 * @return pointer to the buffer which is not on the bus
+		 */
+		uint8_t*			tx( void );
+
+		/** Read data of last completed transfer
+		 *	waits the completion if the transfer is ongoing
+		 *
+		 * @return pointer to the read data
+		 */
+		const uint8_t*		rx( void );
+
+		/** Start transfer of tx() buffer and swap buffers
+		 *	waits the completion of previous transfer if it is ongoing
+		 *
+		 * @param length transfer length
+		 * @param callback (option) function to be called at transfer completion
+		 * @return status_t kStatus_Success if the transfer started
+		 */
+		status_t			send( int length, xfer_cb_t callback = nullptr );
+
+	private:
+		SPI&				_spi;
+		int					_size;
+		int					_index;
+		std::vector<uint8_t>	_tx[ 2 ];
+		std::vector<uint8_t>	_rx[ 2 ];
+	};
+
 protected:
 	DigitalOut				chip_select;
 	bool					manual_cs_control;
 private:
+	void					async_done( status_t status );
+
 #ifdef	CPU_MCXC444VLH
+	static void				async_callback( SPI_Type *base, spi_master_handle_t *handle, status_t status, void *userData );
+
 	spi_master_config_t		masterConfig;
 	SPI_Type				*unit_base;
+	spi_master_handle_t		async_handle;
 #else
+	static void				async_callback( LPSPI_Type *base, lpspi_master_handle_t *handle, status_t status, void *userData );
+	void					frame_bits( uint32_t bits );
+
 	lpspi_master_config_t	masterConfig;
 	LPSPI_Type				*unit_base;
+	lpspi_master_handle_t	async_handle;
 #endif
 	
 	uint32_t				master_clk_freq;
 	uint32_t				master_pcs_4_xfer;
+
+	bool					async_handle_ready;
+	volatile bool			async_busy;
+	volatile status_t		async_status;
+	xfer_cb_t				async_cb;
 };
 
 #endif // R01LIB_SPI_H